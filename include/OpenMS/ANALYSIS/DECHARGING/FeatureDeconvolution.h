@@ -39,6 +39,7 @@
 #include <OpenMS/KERNEL/FeatureMap.h>
 #include <OpenMS/KERNEL/ConsensusMap.h>
 #include <OpenMS/ANALYSIS/DECHARGING/ILPDCWrapper.h>
+#include <OpenMS/DATASTRUCTURES/DBoundingBox.h>
 #include <OpenMS/DATASTRUCTURES/DPosition.h>
 #include <OpenMS/DATASTRUCTURES/MassExplainer.h>
 
@@ -107,6 +108,29 @@ protected:
     **/
     struct CmpInfo_;
 
+    /// settings of the candidate edge search (read from the parameters once per compute() call)
+    struct EdgeSearch_
+    {
+      Int q_min;
+      Int q_max;
+      Int q_span;
+      DoubleReal rt_diff_max;
+      DoubleReal rt_diff_max_local;
+      DoubleReal mz_diff_max;
+      DoubleReal rt_min_overlap;
+      DoubleReal thresh_logp;
+    };
+
+    /**
+        @brief generates all putative edges from feature @p i_RT to the features following it within 'retention_max_diff'
+
+        Edges are appended to @p edges. Explicit adducts induced by them are appended to @p edge_adducts as (feature index, CmpInfo_) with CmpInfo_::idx_cp relative to the start of @p edges.
+        @p rt_bounds holds the convex hull bounding box of each feature of @p fm.
+    **/
+    void generateEdges_(const FeatureMapType & fm, const std::vector<DBoundingBox<2> > & rt_bounds, const MassExplainer & me, const EdgeSearch_ & search, const Size i_RT,
+                        PairsType & edges, std::vector<std::pair<Size, CmpInfo_> > & edge_adducts,
+                        Size & possible_edges, Size & overall_hits, Size & no_cmp_hit, Size & cmp_hit) const;
+
     /*
       @brief test for obviously wrong parameter settings and warn
 
@@ -133,7 +157,7 @@ protected:
         intensity criterion.
 
     **/
-    inline bool intensityFilterPassed_(const Int q1, const Int q2, const Compomer & cmp, const FeatureType & f1, const FeatureType & f2);
+    inline bool intensityFilterPassed_(const Int q1, const Int q2, const Compomer & cmp, const FeatureType & f1, const FeatureType & f2) const;
 
     /**
         @brief determines if we should test a putative feature charge
@@ -59,26 +59,39 @@ public:
 
     /// Compute optimal solution and return value of objective function
     /// If the input feature map is empty, a warning is issued and -1 is returned.
+    /// The putative edge graph is split into connected components. Small components are solved by enumeration,
+    /// the others are grouped into bins which are solved as ILPs (in parallel if OpenMP is enabled).
     /// @return value of objective function
-    /// and @p pairs will have all realized edges set to "active"
-    DoubleReal compute(const FeatureMap<> fm, PairsType & pairs, Size verbose_level) const;
+    /// and @p pairs will have all realized edges set to "active" (@p pairs is reordered by component)
+    DoubleReal compute(const FeatureMap<> & fm, PairsType & pairs, Size verbose_level) const;
 
 private:
 
     /// slicing the problem into subproblems
-    DoubleReal computeSlice_(const FeatureMap<> fm,
+    DoubleReal computeSlice_(const FeatureMap<> & fm,
                              PairsType & pairs,
                              const PairsIndex margin_left,
                              const PairsIndex margin_right,
                              const Size verbose_level) const;
 
     /// slicing the problem into subproblems
-    DoubleReal computeSliceOld_(const FeatureMap<> fm,
+    DoubleReal computeSliceOld_(const FeatureMap<> & fm,
                                 PairsType & pairs,
                                 const PairsIndex margin_left,
                                 const PairsIndex margin_right,
                                 const Size verbose_level) const;
 
+    /// solves the component given by the pairs [@p margin_left, @p margin_right) exactly by enumerating the charge variants of its features
+    /// @return false (leaving @p pairs untouched) if the component is too big for enumeration
+    bool computeSmallComponent_(const FeatureMap<> & fm,
+                                PairsType & pairs,
+                                const PairsIndex margin_left,
+                                const PairsIndex margin_right,
+                                DoubleReal & score) const;
+
+    /// root of the group of feature @p f in the union-find forest @p parent
+    static Size findGroup_(std::vector<Size> & parent, Size f);
+
     /// calculate a score for the i_th edge
     DoubleReal getLogScore_(const PairsType::value_type & pair, const FeatureMap<> & fm) const;
 
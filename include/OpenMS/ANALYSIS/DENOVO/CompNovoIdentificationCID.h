@@ -76,7 +76,12 @@ public:
     /** @name Accessors
      */
     //@{
-    /// performs an ProteinIdentification run on a PeakMap
+    /**
+      @brief performs an ProteinIdentification run on a PeakMap
+
+      The spectra are identified in parallel (if OpenMP is enabled), each thread uses its own
+      copy of the caches. The identifications are returned in the order of the spectra.
+    */
     void getIdentifications(std::vector<PeptideIdentification> & ids, const PeakMap & exp);
 
     /// performs an ProteinIdentification run on a PeakSpectrum
@@ -90,6 +95,9 @@ public:
 
 protected:
 
+    /// annotates the id with RT and m/z of the spectrum, resets the per-spectrum caches and performs the identification
+    void identifySpectrum_(PeptideIdentification & id, const PeakSpectrum & CID_spec);
+
     /// call the DAC algorithm for the subspectrum defined via left and right peaks and fill the set with candidates sequences
     void getDecompositionsDAC_(std::set<String> & sequences, Size left, Size right, DoubleReal peptide_weight, const PeakSpectrum & CID_orig_spec, Map<DoubleReal, IonScore> & CID_nodes);
 
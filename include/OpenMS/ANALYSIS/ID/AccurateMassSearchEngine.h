@@ -48,8 +48,25 @@
 
 #include <vector>
 
+#include <boost/shared_ptr.hpp>
+
 namespace OpenMS
 {
+  namespace Internal
+  {
+    /**
+      @brief Mass-sorted mapping of the HMDB database (masses, formulas and HMDB IDs, one entry per index).
+
+      Shared between AccurateMassSearchEngine and the AccurateMassSearchResult objects it creates, which only reference their database entry by index.
+    */
+    struct AccurateMassSearchDatabase
+    {
+      std::vector<DoubleReal> masses;
+      std::vector<String> formulas;
+      std::vector<std::vector<String> > hmdb_ids;
+    };
+  }
+
     class OPENMS_DLLAPI AccurateMassSearchResult
     {
     public:
@@ -139,6 +156,11 @@ namespace OpenMS
         void outputResults() const;
 
     private:
+        friend class AccurateMassSearchEngine;
+
+        /// copies formula and HMDB IDs from the referenced database entry, so they can be modified
+        void detachDatabaseEntry_();
+
         /// Stored information/results of DB query
         DoubleReal adduct_mass_;
         DoubleReal query_mass_;
@@ -156,6 +178,10 @@ namespace OpenMS
         std::vector<String> matching_hmdb_ids_;
 
         DoubleReal isotopes_sim_score_;
+
+        /// database entry providing formula and HMDB IDs (if set, empirical_formula_ and matching_hmdb_ids_ are unused)
+        boost::shared_ptr<const Internal::AccurateMassSearchDatabase> database_;
+        Size database_index_;
     };
 
 
@@ -174,10 +200,25 @@ public:
     virtual ~AccurateMassSearchEngine();
 
     void queryByMass(const DoubleReal&, const DoubleReal&, std::vector<AccurateMassSearchResult>&);
+
+    /**
+      @brief Queries many adduct masses at once
+
+      Gives the same results as calling queryByMass() for every pair of @p adduct_masses and @p adduct_charges, but sorts the queries and merges them against the mass-sorted database in one sweep per adduct.
+      The hits of query @em i are stored in @p results[i].
+
+      @exception Exception::InvalidParameter is thrown if @p adduct_masses and @p adduct_charges differ in size
+    */
+    void queryByMasses(const std::vector<DoubleReal>& adduct_masses, const std::vector<DoubleReal>& adduct_charges, std::vector<std::vector<AccurateMassSearchResult> >& results);
+
     void queryByFeature(const Feature&, const Size&, std::vector<AccurateMassSearchResult>&);
     void queryByConsensusFeature(const ConsensusFeature&, const Size&, const Size&, std::vector<AccurateMassSearchResult>&);
 
-    /// main method of AccurateMassSearchEngine
+    /**
+      @brief main method of AccurateMassSearchEngine
+
+      The database is loaded on the first call and kept for later ones. All features are queried in one batch (see queryByMasses()) and the isotope similarities are computed in parallel if OpenMP is enabled.
+    */
     void run(const FeatureMap<>&, MzTab&);
     void run(const ConsensusMap&, MzTab&);
 
@@ -190,27 +231,42 @@ private:
     void parseMappingFile_(const String&);
     void parseStructMappingFile_(const String&);
     void parseAdductsFile_(const String&);
-    void searchMass_(const DoubleReal&, std::vector<Size>& hit_indices);
 
-    void parseAdductString_(const String&, std::vector<String>&);
-    void computeNeutralMassFromAdduct_(const DoubleReal&, const String&, DoubleReal&, DoubleReal&);
+    /// parsed adduct string: the neutral mass is computed from the adduct mass by the same steps as in the string, without parsing it again
+    struct AdductRule_
+    {
+      String name;
+      DoubleReal charge;
+      DoubleReal mol_multiplier;
+      bool is_intrinsic;
+      /// signed masses added in order of appearance in the adduct string
+      std::vector<DoubleReal> mass_shifts;
+    };
+
+    void parseAdductString_(const String&, AdductRule_&);
+    DoubleReal computeNeutralMassFromAdduct_(const DoubleReal&, const AdductRule_&) const;
 
-    DoubleReal computeCosineSim_(const std::vector<DoubleReal>& x, const std::vector<DoubleReal>& y);
-    DoubleReal computeEuclideanDist_(const std::vector<DoubleReal>& x, const std::vector<DoubleReal>& y);
-    DoubleReal computeIsotopePatternSimilarity_(const Feature&, const EmpiricalFormula&);
+    DoubleReal computeCosineSim_(const std::vector<DoubleReal>& x, const std::vector<DoubleReal>& y) const;
+    DoubleReal computeEuclideanDist_(const std::vector<DoubleReal>& x, const std::vector<DoubleReal>& y) const;
+    DoubleReal computeIsotopePatternSimilarity_(const Feature&, const EmpiricalFormula&) const;
 
     typedef std::vector<std::vector<AccurateMassSearchResult> > QueryResultsTable;
 
     void exportMzTab_(const QueryResultsTable&, MzTab&);
 
+    /// sets feature information for the hits of a feature and keeps only the best isotope pattern match (if enabled)
+    void annotateFeatureResults_(const Feature&, const Size&, std::vector<AccurateMassSearchResult>&) const;
+    /// sets consensus feature information for the hits of a consensus feature
+    void annotateConsensusFeatureResults_(const ConsensusFeature&, const Size&, const Size&, std::vector<AccurateMassSearchResult>&) const;
+
+    /// loads database and adducts (the database only once)
+    void prepareSearch_();
+
     /// private member variables
-    typedef std::vector<std::vector<String> > MassIDMapping;
     typedef std::map<String, std::vector<String> > HMDBPropsMapping;
 
-    std::vector<DoubleReal> masskey_table_;
-    MassIDMapping mass_id_mapping_;
+    boost::shared_ptr<Internal::AccurateMassSearchDatabase> database_;
     HMDBPropsMapping hmdb_properties_mapping_;
-    std::vector<String> mass_formula_mapping_;
 
     /// parameter stuff
     DoubleReal mass_error_value_;
@@ -223,6 +279,9 @@ private:
 
     StringList pos_adducts_;
     StringList neg_adducts_;
+
+    /// parsed adducts of the current ionization mode
+    std::vector<AdductRule_> adduct_rules_;
   };
 
 
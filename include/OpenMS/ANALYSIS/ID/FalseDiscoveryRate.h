@@ -80,6 +80,10 @@ public:
     /**
         @brief Calculates the FDR of one run from a concatenated sequence db search
 
+        The scores of all hits are extracted in a single pass and grouped by charge variant and/or run
+        (see parameters 'split_charge_variants' and 'treat_runs_separately'); the groups are evaluated in parallel
+        if OpenMP is enabled.
+
 @param id peptide identifications, containing target and decoy hits
     */
     void apply(std::vector<PeptideIdentification> & id);
@@ -110,6 +114,9 @@ private:
     /// calculates the fdr stored into fdrs, given two vectors of scores
     void calculateFDRs_(Map<DoubleReal, DoubleReal> & score_to_fdr, std::vector<DoubleReal> & target_scores, std::vector<DoubleReal> & decoy_scores, bool q_value, bool higher_score_better);
 
+    /// returns the first index of @p sorted_scores (sorted ascending or descending) with minimal distance to @p score
+    static Size findClosestScore_(const std::vector<DoubleReal> & sorted_scores, DoubleReal score, bool ascending);
+
   };
 
 } // namespace OpenMS
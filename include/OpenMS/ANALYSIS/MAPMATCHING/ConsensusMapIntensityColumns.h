@@ -0,0 +1,112 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Lars Nilse $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_ANALYSIS_MAPMATCHING_CONSENSUSMAPINTENSITYCOLUMNS_H
+#define OPENMS_ANALYSIS_MAPMATCHING_CONSENSUSMAPINTENSITYCOLUMNS_H
+
+#include <OpenMS/KERNEL/ConsensusMap.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+
+  /**
+   * @brief Column-wise (per input map) view of the feature intensities of a consensus map
+   *
+   * The intensities of all feature handles of one input map are stored in one
+   * contiguous array, in the order of the consensus features. For every entry,
+   * a reference to the feature handle (index of the consensus feature and
+   * position of the handle in it) is stored as well, so that modified
+   * intensities can be written back.
+   *
+   * Extraction and writing back are parallelized (OpenMP), so the columns can
+   * be processed independently of each other, e.g. by the normalization
+   * algorithms of ConsensusMapNormalizer.
+   *
+   * @note The references to the feature handles become invalid if the
+   * consensus map is modified (other than changing intensities) after the
+   * extraction. Consensus maps are limited to 2^32 consensus features.
+   */
+  class OPENMS_DLLAPI ConsensusMapIntensityColumns
+  {
+public:
+    /// Reference to a feature handle: index of the consensus feature and position of the handle in it
+    struct HandleReference
+    {
+      UInt feature_index;
+      UInt handle_index;
+    };
+
+    /**
+     * @brief extracts the intensity columns of a consensus map
+     * @param map ConsensusMap; the number of columns is the number of file descriptions
+     * @exception Exception::IndexOverflow if a feature handle refers to a map without file description
+     */
+    explicit ConsensusMapIntensityColumns(const ConsensusMap & map);
+
+    /// returns the number of columns (input maps)
+    Size size() const;
+
+    /// returns the number of entries in column @p map_index
+    Size size(Size map_index) const;
+
+    /// returns the intensities of column @p map_index (mutable, see writeIntensities())
+    std::vector<double> & getIntensities(Size map_index);
+
+    /// returns the intensities of column @p map_index
+    const std::vector<double> & getIntensities(Size map_index) const;
+
+    /// returns the references to the feature handles of the entries in column @p map_index (ascending by consensus feature)
+    const std::vector<HandleReference> & getReferences(Size map_index) const;
+
+    /**
+     * @brief writes the (modified) intensities back to the feature handles
+     * @param map the ConsensusMap the columns were extracted from
+     * @exception Exception::Precondition if the number of consensus features of @p map changed
+     */
+    void writeIntensities(ConsensusMap & map) const;
+
+protected:
+    /// number of consensus features of the map
+    Size number_of_features_;
+    /// intensities per input map
+    std::vector<std::vector<double> > intensities_;
+    /// feature handle references per input map
+    std::vector<std::vector<HandleReference> > references_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_ANALYSIS_MAPMATCHING_CONSENSUSMAPINTENSITYCOLUMNS_H
@@ -51,6 +51,7 @@ namespace OpenMS
   - @p linear (TransformationModelLinear): \f$ f(x) = slope * x + intercept \f$
   - @p interpolated (TransformationModelInterpolated): Interpolation between pairs, extrapolation using first and last pair. Supports different interpolation types.
   - @p b_spline (TransformationModelBSpline): Smoothing cubic B-spline.
+  - @p lowess (TransformationModelLowess): Locally weighted scatterplot smoothing, robust to outliers.
 
   @remark TransformationDescription stores data points, TransformationModel stores parameters. That way, data can be modeled using different models/parameters, and models can still keep a representation of the data in the format they need (if at all).
 
@@ -90,6 +91,13 @@ public:
     */
     DoubleReal apply(DoubleReal value) const;
 
+    /**
+         @brief Applies the transformation to all @p values (in place).
+
+         Gives the same results as applying the transformation to every value separately, but is faster for many (especially sorted) values.
+    */
+    void apply(std::vector<DoubleReal> & values) const;
+
     /// Gets the type of the fitted model
     const String & getModelType() const;
 
@@ -74,6 +74,13 @@ public:
       return value;
     }
 
+    /**
+         @brief Evaluates the model at all given values (in place)
+
+         Gives the same results as evaluating every value separately. The interpolating models are faster if the values are sorted. Large inputs are evaluated in parallel blocks.
+    */
+    void evaluate(std::vector<DoubleReal> & values) const;
+
     /// Gets the (actual) parameters
     void getParameters(Param & params) const
     {
@@ -87,6 +94,13 @@ public:
     }
 
 protected:
+    /**
+         @brief Evaluates the model at the values in [@p begin, @p end) (in place)
+
+         Called concurrently on different ranges, so implementations must not change the model.
+    */
+    virtual void evaluateRange_(DoubleReal * begin, DoubleReal * end) const;
+
     /// Parameters
     Param params_;
   };
@@ -118,6 +132,8 @@ public:
     /// Evaluates the model at the given value
     virtual DoubleReal evaluate(const DoubleReal value) const;
 
+    using TransformationModel::evaluate;
+
     using TransformationModel::getParameters;
 
     /// Gets the "real" parameters
@@ -134,6 +150,9 @@ public:
     void invert();
 
 protected:
+    /// Evaluates the model at the values in [@p begin, @p end) (in place)
+    virtual void evaluateRange_(DoubleReal * begin, DoubleReal * end) const;
+
     /// Parameters of the linear model
     DoubleReal slope_, intercept_;
     /// Was the model estimated from data?
@@ -170,16 +189,19 @@ public:
     /// Evaluates the model at the given value
     DoubleReal evaluate(const DoubleReal value) const;
 
+    using TransformationModel::evaluate;
+
     /// Gets the default parameters
     static void getDefaultParameters(Param & params);
 
 protected:
+    /// Evaluates the model at the values in [@p begin, @p end) (in place), using a look-up accelerator per range
+    virtual void evaluateRange_(DoubleReal * begin, DoubleReal * end) const;
+
     /// Data coordinates
     std::vector<double> x_, y_;
     /// Number of data points
     size_t size_;
-    /// Look-up accelerator
-    gsl_interp_accel * acc_;
     /// Interpolation function
     gsl_interp * interp_;
     /// Linear model for extrapolation
@@ -194,6 +216,8 @@ protected:
 
        Positioning of the breakpoints is controlled by the parameter @p break_positions. Valid choices are "uniform" (equidistant spacing on the data range) and "quantiles" (equal numbers of data points in every interval).
 
+       The fitted spline is evaluated with de Boor's algorithm on copies of the knots and coefficients, so evaluation does not use the (shared) GSL workspace and is thread-safe.
+
        @ingroup MapAlignment
   */
   class OPENMS_DLLAPI TransformationModelBSpline :
@@ -213,6 +237,8 @@ public:
     /// Evaluates the model at the given value
     DoubleReal evaluate(const DoubleReal value) const;
 
+    using TransformationModel::evaluate;
+
     /// Gets the default parameters
     static void getDefaultParameters(Param & params);
 
@@ -234,6 +260,17 @@ protected:
     void computeLinear_(const double pos, double & slope, double & offset,
                         double & sd_err);
 
+    /// Evaluates the model at the values in [@p begin, @p end) (in place)
+    virtual void evaluateRange_(DoubleReal * begin, DoubleReal * end) const;
+
+    /**
+        @brief Evaluates the spline at @p value (within the knot range)
+
+        @param value Position to evaluate
+        @param interval Index of the knot interval containing @p value; used as a hint and updated
+    */
+    double evaluateSpline_(const double value, Size & interval) const;
+
     /// Vectors for B-spline computation
     gsl_vector * x_, * y_, * w_, * bsplines_, * coeffs_;
     /// Covariance matrix
@@ -248,6 +285,71 @@ protected:
     double slope_min_, slope_max_, offset_min_, offset_max_;
     /// Fitting errors of linear extrapolation
     double sd_err_left_, sd_err_right_;
+    /// Knots and fitted coefficients of the spline (for evaluation)
+    std::vector<double> knots_, coefficients_;
+  };
+
+
+  /**
+       @brief LOWESS (locally weighted scatterplot smoothing) model for transformations
+
+       The data points are smoothed by local linear regressions with tricube weights over the nearest @p span fraction of the points, followed by @p num_iterations robustifying iterations that down-weight outliers (Cleveland, 1979). Between the smoothed points, the transformation is interpolated linearly. Outside of their range, we extrapolate using a line through the first and the last smoothed point.
+
+       The local regressions are only computed at points that are at least @p delta apart (by default 1% of the data range); the smoothed values in between are interpolated linearly. With this, fitting takes linear time after sorting, also for many data points.
+
+       @ingroup MapAlignment
+  */
+  class OPENMS_DLLAPI TransformationModelLowess :
+    public TransformationModel
+  {
+public:
+    /**
+         @brief Constructor
+
+         @exception IllegalArgument is thrown if less than two data points are given.
+    */
+    TransformationModelLowess(const DataPoints & data, const Param & params);
+
+    /// Destructor
+    ~TransformationModelLowess();
+
+    /// Evaluates the model at the given value
+    DoubleReal evaluate(const DoubleReal value) const;
+
+    using TransformationModel::evaluate;
+
+    /// Gets the default parameters
+    static void getDefaultParameters(Param & params);
+
+protected:
+    /// Evaluates the model at the values in [@p begin, @p end) (in place)
+    virtual void evaluateRange_(DoubleReal * begin, DoubleReal * end) const;
+
+    /**
+         @brief Smooths the sorted points (@p x, @p y), like R's "lowess" function
+
+         @param x Sorted x values
+         @param y Corresponding y values
+         @param span Fraction of the points used for each local regression
+         @param num_iterations Number of robustifying iterations
+         @param delta Distance within which the local regressions are replaced by linear interpolation
+         @param smoothed Resulting smoothed y values
+    */
+    static void smooth_(const std::vector<double> & x, const std::vector<double> & y, double span, Size num_iterations, double delta, std::vector<double> & smoothed);
+
+    /**
+         @brief Computes the local regression at @p x_i
+
+         Uses the points in the window [@p left, @p right] (extended to ties at the right end), weighted by @p robustness_weights. @p weights is a work space of the size of @p x.
+
+         @return False if all weights are zero (@p result is not set then)
+    */
+    static bool fitLocal_(const std::vector<double> & x, const std::vector<double> & y, const double x_i, const Size left, const Size right, const std::vector<double> & robustness_weights, std::vector<double> & weights, double & result);
+
+    /// Smoothed coordinates (unique, sorted x values)
+    std::vector<double> x_, y_;
+    /// Linear model for extrapolation
+    TransformationModelLinear * lm_;
   };
 
 } // end of namespace OpenMS
@@ -5,6 +5,7 @@ set(directory include/OpenMS/ANALYSIS/MAPMATCHING)
 set(sources_list_h
 BaseGroupFinder.h
 BaseSuperimposer.h
+ConsensusMapIntensityColumns.h
 ConsensusMapNormalizerAlgorithmThreshold.h
 ConsensusMapNormalizerAlgorithmMedian.h
 ConsensusMapNormalizerAlgorithmQuantile.h
@@ -340,6 +340,9 @@ public:
     /**
       @brief Performs a CV for the data given by 'problem'
 
+      The folds of a grid cell are evaluated in parallel if OpenMP is enabled.
+      For the oligo kernel the kernel matrices of the folds are computed only
+      once per border length and sigma and reused for all other parameters.
     */
     DoubleReal performCrossValidation(svm_problem * problem_ul,
                                       const SVMData & problem_l,
@@ -462,6 +465,10 @@ public:
       are used together wit the oligo kernel function (could be extended if you
       want to use your own kernel functions).
 
+      The rows are computed in parallel if OpenMP is enabled. If both arguments
+      are the same object, only the upper triangle is evaluated.
+
+      @exception Exception::InvalidParameter is thrown if the gauss table is too short for the encoded sequences
     */
     svm_problem * computeKernelMatrix(const SVMData & problem1, const SVMData & problem2);
 
@@ -508,6 +515,21 @@ private:
                    const bool additive_step_sizes,
                    std::vector<DoubleReal> & actual_values);
 
+    /**
+       @brief trains a model on @p training_problem and stores its performance on @p test_problem in @p performance
+
+       Uses a copy of the svm parameters and a local model, so several folds of a
+       cross validation can be evaluated concurrently. Both problems have to be
+       kernel matrices if the oligo kernel is used. Returns false if the parameters
+       are not valid for @p training_problem.
+
+       @exception Exception::InvalidRange is thrown if @p test_problem is empty
+    */
+    bool evaluateFold_(svm_problem * training_problem,
+                       svm_problem * test_problem,
+                       bool mcc_as_performance_measure,
+                       DoubleReal & performance) const;
+
     Size getNumberOfEnclosedPoints_(DoubleReal m1, DoubleReal m2, const std::vector<std::pair<DoubleReal, DoubleReal> > & points);
 
     /**
@@ -80,7 +80,7 @@ public:
     Param params;
     params.setValue("type", default_model, "Type of model");
     // TODO: avoid referring to each TransformationModel subclass explicitly
-    StringList model_types = StringList::create("linear,b_spline,interpolated");
+    StringList model_types = StringList::create("linear,b_spline,interpolated,lowess");
     if (!model_types.contains(default_model))
     {
       model_types.insert(model_types.begin(), default_model);
@@ -106,6 +106,9 @@ public:
     params.insert("interpolated:", model_params);
     params.setSectionDescription("interpolated",
                                  "Parameters for 'interpolated' model");
+    TransformationModelLowess::getDefaultParameters(model_params);
+    params.insert("lowess:", model_params);
+    params.setSectionDescription("lowess", "Parameters for 'lowess' model");
     return params;
   }
 
@@ -37,6 +37,7 @@
 
 #include <OpenMS/CONCEPT/Types.h>
 #include <OpenMS/CHEMISTRY/AASequence.h>
+#include <OpenMS/DATASTRUCTURES/StringView.h>
 
 #include <string>
 #include <vector>
@@ -59,6 +60,11 @@ namespace OpenMS
    The model is only available for trypsin and ignores the missed cleavage setting. You should however use setLogThreshold()
    to adjust FP vs FN rates. A higher threshold increases the number of cleavages predicted.
 
+   For large databases the proteins can also be digested as raw one-letter sequences (see digestRaw()).
+   This avoids the construction of AASequence objects: the products are stored as positions within the
+   protein sequences in a single flat vector, their monoisotopic weights are computed from prefix sums
+   of the residue weights. Modifications are not supported in this mode.
+
        @ingroup Chemistry
   */
   class OPENMS_DLLAPI EnzymaticDigestion
@@ -84,6 +90,21 @@ public:
     /// Names of the Specificity
     static const std::string NamesOfSpecificity[SIZE_OF_SPECIFICITY];
 
+    /// A digestion product of digestRaw(), i.e. a peptide given by its position in a protein sequence
+    struct DigestionProduct
+    {
+      /// index of the protein the peptide belongs to
+      UInt protein_index;
+      /// start position of the peptide within the protein sequence
+      UInt start;
+      /// number of residues of the peptide
+      UInt length;
+      /// number of missed cleavages within the peptide
+      UInt missed_cleavages;
+      /// monoisotopic weight of the uncharged peptide (residues + H2O)
+      DoubleReal mono_weight;
+    };
+
 
     /// Default constructor
     EnzymaticDigestion();
@@ -124,6 +145,22 @@ public:
     /// Performs the enzymatic digestion of a protein.
     void digest(const AASequence & protein, std::vector<AASequence> & output) const;
 
+    /**
+      @brief Performs the enzymatic digestion of many proteins given as raw one-letter sequences.
+
+      The digestion products are appended to @p output in the order of the proteins. For each protein
+      they are ordered like the output of digest(), i.e. all fully cleaved peptides first, followed by
+      the peptides with one, two, ... missed cleavages. Only peptides with at least @p min_length and at most
+      @p max_length residues are reported (0 means no upper limit).
+
+      If @p unique is set, only the first occurrence of each peptide sequence is kept.
+
+      The proteins are digested in parallel if OpenMP is enabled. The result does not depend on the number of threads.
+
+      @exception Exception::InvalidValue is thrown if a sequence contains a character which is not a known one-letter code
+    */
+    void digestRaw(const std::vector<StringView> & proteins, std::vector<DigestionProduct> & output, Size min_length = 1, Size max_length = 0, bool unique = false) const;
+
     /// Returns the number of peptides a digestion of @p protein would yield under the current enzyme and missed cleavage settings.
     Size peptideCount(const AASequence & protein);
 
@@ -186,6 +223,17 @@ protected:
     /// tests if position pointed to by @p p (N-term side) is a valid cleavage site
     bool isCleavageSite_(const AASequence & sequence, const AASequence::ConstIterator & p) const;
 
+    /// tests if position @p pos (N-term side) of the raw sequence @p protein is a valid cleavage site
+    bool isCleavageSite_(const StringView & protein, Size pos) const;
+
+    /**
+      @brief Digests a single raw sequence (see digestRaw())
+
+      @p residue_weights holds the internal monoisotopic weight of each character, @p known_residues marks the valid characters,
+      @p boundaries and @p prefix_weights are reused buffers. Returns false if the sequence contains an unknown character.
+    */
+    bool digestRaw_(const StringView & protein, UInt protein_index, const std::vector<DoubleReal> & residue_weights, const std::vector<bool> & known_residues, Size min_length, Size max_length, std::vector<Size> & boundaries, std::vector<DoubleReal> & prefix_weights, std::vector<DigestionProduct> & output) const;
+
     /// Number of missed cleavages
     SignedSize missed_cleavages_;
     /// Used enzyme
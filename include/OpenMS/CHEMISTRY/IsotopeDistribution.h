@@ -125,6 +125,10 @@ public:
 
         Implementation using the averagine model proposed by Senko et al. in
         "Determination of Monoisotopic Masses and Ion Populations for Large Biomolecules from Resolved Isotopic Distributions"
+
+        The averagine element counts are rounded, so all weights which lead to the same
+        counts share one distribution. For a non-zero max isotope these distributions are
+        cached process-wide (thread-safe), which makes repeated estimates cheap.
     */
     void estimateFromPeptideWeight(double average_weight);
 
@@ -202,6 +206,27 @@ protected:
     /// convolves the distribution @p input with itself and stores the result in @p result
     void convolveSquare_(ContainerType & result, const ContainerType & input) const;
 
+    /**
+        @brief convolves the dense probability arrays @p left and @p right
+
+        The arrays hold the probabilities of consecutive isotopes. At most @p r_max
+        entries of the result are computed (all if @p r_max is 0). Long arrays are
+        convolved via FFT, short ones directly.
+    */
+    static void convolveDense_(std::vector<double> & result, const std::vector<double> & left, const std::vector<double> & right, Size r_max);
+
+    /// FFT based part of convolveDense_, negative round-off values are set to zero
+    static void convolveFFT_(std::vector<double> & result, const std::vector<double> & left, const std::vector<double> & right, Size r_max);
+
+    /// dense version of convolvePow_, @p result_first receives the weight of the first isotope of @p result
+    void convolvePowDense_(std::vector<double> & result, Size & result_first, const std::vector<double> & input, Size input_first, Size n) const;
+
+    /// splits @p container into the weight of its first isotope and the dense probability array
+    static Size toDense_(std::vector<double> & dense, const ContainerType & container);
+
+    /// builds a container from the dense probability array @p dense starting at weight @p first
+    static void fromDense_(ContainerType & container, const std::vector<double> & dense, Size first);
+
     /// maximal isotopes which is used to calculate the distribution
     Size max_isotope_;
 
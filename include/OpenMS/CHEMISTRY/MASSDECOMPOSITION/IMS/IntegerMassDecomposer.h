@@ -38,6 +38,8 @@
 
 #include <vector>
 #include <utility>
+#include <istream>
+#include <ostream>
 
 #include <OpenMS/CHEMISTRY/MASSDECOMPOSITION/IMS/Weights.h>
 #include <OpenMS/CHEMISTRY/MASSDECOMPOSITION/IMS/MassDecomposer.h>
@@ -94,6 +96,35 @@ public:
       */
       explicit IntegerMassDecomposer(const Weights & alphabet);
 
+      /**
+        Constructor with weights and a residue table written by storeTable().
+
+        The table is read from @c table if it was computed for the same (integer)
+        weights, otherwise it is computed as in the other constructor.
+
+        @param alphabet Weights over which masses to be decomposed.
+        @param table Stream containing a residue table.
+        @see isTableLoaded()
+      */
+      IntegerMassDecomposer(const Weights & alphabet, std::istream & table);
+
+      /**
+        Writes the residue table (including the weights it belongs to) in binary
+        form, so it can be reused by the stream constructor.
+
+        @param table Stream to write the table to.
+      */
+      void storeTable(std::ostream & table) const;
+
+      /**
+        Returns true if the residue table was read from a stream instead of
+        being computed.
+      */
+      bool isTableLoaded() const
+      {
+        return table_loaded_;
+      }
+
       /**
         Returns true if decomposition over the @c mass exists, otherwise - false.
 
@@ -181,6 +212,11 @@ private:
       */
       witness_vector_type witness_vector_;
 
+      /**
+        Whether the residue table was read from a stream.
+      */
+      bool table_loaded_;
+
       /**
         Fills the extended residues table.
       */
@@ -188,6 +224,27 @@ private:
                                      residues_table_row_type & _mass_in_lcms, const value_type _infty,
                                      witness_vector_type & _witness_vector, residues_table_type & _ertable);
 
+      /**
+        Reads the tables written by storeTable(). Returns false if the stream does
+        not contain the tables for the weights of this decomposer.
+      */
+      bool loadTable_(std::istream & table);
+
+      /// Writes a block of values in binary form
+      template <typename T>
+      static void writeBinary_(std::ostream & out, const T * data, std::size_t count)
+      {
+        out.write(reinterpret_cast<const char *>(data), count * sizeof(T));
+      }
+
+      /// Reads a block of values in binary form
+      template <typename T>
+      static bool readBinary_(std::istream & in, T * data, std::size_t count)
+      {
+        in.read(reinterpret_cast<char *>(data), count * sizeof(T));
+        return in.good();
+      }
+
       /**
         Collects decompositions for @c mass by recursion.
 
@@ -204,7 +261,8 @@ private:
     template <typename ValueType, typename DecompositionValueType>
     IntegerMassDecomposer<ValueType, DecompositionValueType>::IntegerMassDecomposer(
       const Weights & alphabet) :
-      alphabet_(alphabet)
+      alphabet_(alphabet),
+      table_loaded_(false)
     {
 
       lcms_.resize(alphabet.size());
@@ -216,6 +274,125 @@ private:
 
     }
 
+    template <typename ValueType, typename DecompositionValueType>
+    IntegerMassDecomposer<ValueType, DecompositionValueType>::IntegerMassDecomposer(
+      const Weights & alphabet, std::istream & table) :
+      alphabet_(alphabet),
+      table_loaded_(false)
+    {
+      infty_ = alphabet.getWeight(0) * alphabet.getWeight(alphabet.size() - 1);
+
+      table_loaded_ = loadTable_(table);
+      if (!table_loaded_)
+      {
+        lcms_.assign(alphabet.size(), 0);
+        mass_in_lcms_.assign(alphabet.size(), 0);
+        witness_vector_.clear();
+        ertable_.clear();
+
+        fillExtendedResidueTable_(alphabet, lcms_, mass_in_lcms_, infty_, witness_vector_, ertable_);
+      }
+    }
+
+    template <typename ValueType, typename DecompositionValueType>
+    void IntegerMassDecomposer<ValueType, DecompositionValueType>::storeTable(std::ostream & table) const
+    {
+      // header: sizes of the value types and the weights the table was computed for
+      unsigned long long header[4] = { sizeof(value_type), sizeof(decomposition_value_type), alphabet_.size(), ertable_.size() };
+      writeBinary_(table, header, 4);
+      for (size_type i = 0; i < alphabet_.size(); ++i)
+      {
+        value_type weight = alphabet_.getWeight(i);
+        writeBinary_(table, &weight, 1);
+      }
+      writeBinary_(table, &infty_, 1);
+      if (ertable_.empty())
+      {
+        return;
+      }
+
+      writeBinary_(table, &lcms_[0], lcms_.size());
+      writeBinary_(table, &mass_in_lcms_[0], mass_in_lcms_.size());
+
+      // the witness vector is written as two separate columns
+      std::vector<unsigned long long> witness_index(witness_vector_.size());
+      std::vector<decomposition_value_type> witness_count(witness_vector_.size());
+      for (size_type i = 0; i < witness_vector_.size(); ++i)
+      {
+        witness_index[i] = witness_vector_[i].first;
+        witness_count[i] = witness_vector_[i].second;
+      }
+      writeBinary_(table, &witness_index[0], witness_index.size());
+      writeBinary_(table, &witness_count[0], witness_count.size());
+
+      for (size_type i = 0; i < ertable_.size(); ++i)
+      {
+        writeBinary_(table, &ertable_[i][0], ertable_[i].size());
+      }
+    }
+
+    template <typename ValueType, typename DecompositionValueType>
+    bool IntegerMassDecomposer<ValueType, DecompositionValueType>::loadTable_(std::istream & table)
+    {
+      unsigned long long header[4];
+      if (!readBinary_(table, header, 4) || header[0] != sizeof(value_type) || header[1] != sizeof(decomposition_value_type) || header[2] != alphabet_.size())
+      {
+        return false;
+      }
+      for (size_type i = 0; i < alphabet_.size(); ++i)
+      {
+        value_type weight;
+        if (!readBinary_(table, &weight, 1) || weight != alphabet_.getWeight(i))
+        {
+          return false;
+        }
+      }
+      value_type infty;
+      if (!readBinary_(table, &infty, 1) || infty != infty_)
+      {
+        return false;
+      }
+      // tables are only computed for at least two weights
+      if (header[3] != (alphabet_.size() < 2 ? 0 : alphabet_.size()))
+      {
+        return false;
+      }
+      lcms_.assign(alphabet_.size(), 0);
+      mass_in_lcms_.assign(alphabet_.size(), 0);
+      if (header[3] == 0)
+      {
+        return true;
+      }
+
+      const size_type smallest_mass = alphabet_.getWeight(0);
+      if (!readBinary_(table, &lcms_[0], lcms_.size()) || !readBinary_(table, &mass_in_lcms_[0], mass_in_lcms_.size()))
+      {
+        return false;
+      }
+
+      std::vector<unsigned long long> witness_index(smallest_mass);
+      std::vector<decomposition_value_type> witness_count(smallest_mass);
+      if (!readBinary_(table, &witness_index[0], smallest_mass) || !readBinary_(table, &witness_count[0], smallest_mass))
+      {
+        return false;
+      }
+      witness_vector_.resize(smallest_mass);
+      for (size_type i = 0; i < smallest_mass; ++i)
+      {
+        witness_vector_[i] = std::make_pair(static_cast<size_type>(witness_index[i]), witness_count[i]);
+      }
+
+      ertable_.assign(alphabet_.size(), residues_table_row_type(smallest_mass));
+      for (size_type i = 0; i < ertable_.size(); ++i)
+      {
+        if (!readBinary_(table, &ertable_[i][0], smallest_mass))
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
     template <typename ValueType, typename DecompositionValueType>
     void IntegerMassDecomposer<ValueType, DecompositionValueType>::fillExtendedResidueTable_(
       const Weights & _alphabet, residues_table_row_type & _lcms, residues_table_row_type & _mass_in_lcms,
@@ -38,7 +38,10 @@
 
 #include <utility>
 #include <map>
-#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/shared_ptr.hpp>
 
 #include <OpenMS/CHEMISTRY/MASSDECOMPOSITION/IMS/IntegerMassDecomposer.h>
 
@@ -90,6 +93,19 @@ public:
       */
       explicit RealMassDecomposer(const Weights & weights);
 
+      /**
+        Constructor with weights and a residue table file.
+
+        If no decomposer for the same weights exists in this process, the residue
+        table is read from @c table_file (if it was stored for the same weights)
+        or computed and written to @c table_file. This avoids recomputing large
+        tables (small precision values) in each process.
+
+        @param weights Weights over which values/masses to be decomposed.
+        @param table_file Binary file to read the residue table from / write it to.
+      */
+      RealMassDecomposer(const Weights & weights, const std::string & table_file);
+
       /**
         Gets all decompositions for a @c mass with an @c error allowed.
 
@@ -101,6 +117,16 @@ public:
 
       decompositions_type getDecompositions(double mass, double error, const constraints_type & constraints);
 
+      /**
+        Gets all decompositions for each of the given @c masses with an @c error
+        allowed. The masses are decomposed in parallel (if OpenMP is enabled).
+
+        @param masses Masses to be decomposed.
+        @param error Error allowed between given and result decomposition.
+        @param decompositions All possible decompositions for each mass (same order as @c masses).
+      */
+      void getDecompositions(const std::vector<double> & masses, double error, std::vector<decompositions_type> & decompositions);
+
       /**
        Gets a number of all decompositions for a @c mass with an @c error
        allowed. It's similar to the @c getDecompositions(double,double) function
@@ -124,9 +150,17 @@ private:
 
       /**
         Decomposer to be used for exact decomposing using
-        integer arithmetics.
+        integer arithmetics. The decomposer (and its residue table) is shared
+        by all decomposers with the same weights, it is only read after construction.
+      */
+      boost::shared_ptr<integer_decomposer_type> decomposer_;
+
+      /**
+        Returns the integer decomposer for the weights, reusing the one of an
+        existing decomposer if possible. If no decomposer exists and @c table_file
+        is not empty, the residue table is read from / written to that file.
       */
-      std::auto_ptr<integer_decomposer_type> decomposer_;
+      static boost::shared_ptr<integer_decomposer_type> getIntegerDecomposer_(const Weights & weights, const std::string & table_file);
     };
 
   } // namespace ims
@@ -88,12 +88,18 @@ public:
     //@{
     /// returns the possible decompositions given the weight
     void getDecompositions(std::vector<MassDecomposition> & decomps, DoubleReal weight);
+
+    /// returns the possible decompositions for each of the given weights (decomposed in parallel)
+    void getDecompositions(std::vector<std::vector<MassDecomposition> > & decomps, const std::vector<DoubleReal> & weights);
     //@}
 
 protected:
 
     void updateMembers_();
 
+    /// converts the decompositions of the decomposer into MassDecompositions
+    void convertDecompositions_(const ims::RealMassDecomposer::decompositions_type & decompositions, std::vector<MassDecomposition> & decomps) const;
+
     ims::IMSAlphabet * alphabet_;
 
     ims::RealMassDecomposer * decomposer_;
@@ -50,6 +50,10 @@ namespace OpenMS
       The details of the method can be found in:
       Backhaus, Erichson, Plinke, Weiber Multivariate Analysemethoden, Springer 2000 and
       Ellen M. Voorhees: Implementing agglomerative hierarchic clustering algorithms for use in document retrieval. Inf. Process. Manage. 22(6): 465-476 (1986)
+
+      The minimum-distance pair is found from the cached minima of each row of the DistanceMatrix (Daniel Muellner: Modern hierarchical,
+      agglomerative clustering algorithms. arXiv:1109.2378 (2011)), merged clusters are kept in the row of their smallest element.
+      This avoids rescanning and shrinking the whole matrix in each clustering step, the merging order is the same.
       @see ClusterFunctor
 
       @ingroup SpectraClustering
@@ -100,6 +100,17 @@ public:
     /// registers all derived products
     static void registerChildren();
 
+protected:
+
+    /**
+        @brief finds the minimal distance of row @p row to the active columns left of the main diagonal
+
+        Helper for the clustering methods that merge the minimum-distance pair of active rows in place (e.g. CompleteLinkage).
+        The minimum is stored in @p row_min and its column (the first one for ties) in @p row_min_col.
+        If the row has no active column, @p row_min_col is set to @p row.
+    */
+    static void updateRowMinimum_(const DistanceMatrix<Real> & distance, const std::vector<bool> & active, Size row, std::vector<Real> & row_min, std::vector<Size> & row_min_col);
+
   };
 
 }
@@ -44,6 +44,7 @@
 #include <OpenMS/KERNEL/StandardTypes.h>
 #include <OpenMS/DATASTRUCTURES/DistanceMatrix.h>
 #include <OpenMS/COMPARISON/CLUSTERING/ClusterFunctor.h>
+#include <OpenMS/COMPARISON/CLUSTERING/SingleLinkage.h>
 #include <OpenMS/COMPARISON/CLUSTERING/ClusterAnalyzer.h>
 #include <OpenMS/COMPARISON/SPECTRA/PeakSpectrumCompareFunctor.h>
 #include <OpenMS/COMPARISON/SPECTRA/BinnedSpectrum.h>
@@ -51,6 +52,7 @@
 #include <OpenMS/CONCEPT/Exception.h>
 
 #include <vector>
+#include <algorithm>
 
 namespace OpenMS
 {
@@ -59,6 +61,10 @@ namespace OpenMS
       @brief Hierarchical clustering with generic clustering functions
 
       ClusterHierarchical clusters objects with corresponding distancemethod and clusteringmethod.
+
+      The pairwise distances are computed in parallel if OpenMP is enabled, so the similarity functors have to be thread-safe in their const operator().
+      For large data sets, where a full DistanceMatrix does not fit into memory, clusterSparse() offers single linkage clustering on the distances below the threshold only.
+
       @ingroup SpectraClustering
   */
   class OPENMS_DLLAPI ClusterHierarchical
@@ -112,14 +118,7 @@ public:
         //create distancematrix for data with comparator
         original_distance.clear();
         original_distance.resize(data.size(), 1);
-        for (Size i = 0; i < data.size(); i++)
-        {
-          for (Size j = 0; j < i; j++)
-          {
-            //distance value is 1-similarity value, since similarity is in range of [0,1]
-            original_distance.setValueQuick(i, j, 1 - comparator(data[i], data[j]));
-          }
-        }
+        fillDistanceMatrix_(data, comparator, original_distance);
       }
 
       //~ std::cout << "done" << std::endl; //maybe progress handler?
@@ -159,18 +158,87 @@ public:
       //create distancematrix for data with comparator
       original_distance.clear();
       original_distance.resize(data.size(), 1);
+      fillDistanceMatrix_(binned_data, comparator, original_distance);
+      original_distance.updateMinElement();
+
+      // create Clustering with ClusterMethod, DistanceMatrix and Data
+      clusterer(original_distance, cluster_tree, threshold_);
+    }
+
+    /**
+        @brief single linkage clustering on a sparse distance graph
+
+        Only the distances below the threshold (see setThreshold()) are kept, so the memory needed is proportional to the number of
+        related pairs instead of quadratic in the number of elements. The pairwise distances are computed like in cluster().
+        Up to the threshold the result is the same as SingleLinkage on the full DistanceMatrix, the remaining clustering steps are
+        dummy nodes with distance -1 (as in CompleteLinkage or AverageLinkage).
+
+        @param data vector of objects to be clustered
+        @param comparator similarity functor fitting for types in data
+        @param cluster_tree the vector that will hold the BinaryTreeNodes representing the clustering (for further investigation with the ClusterAnalyzer methods)
+        @throw ClusterFunctor::InsufficientInput thrown if @p data contains less than two elements
+        @see SingleLinkage, BinaryTreeNode, ClusterAnalyzer
+    */
+    template <typename Data, typename SimilarityComparator>
+    void clusterSparse(std::vector<Data> & data, const SimilarityComparator & comparator, std::vector<BinaryTreeNode> & cluster_tree)
+    {
+      if (data.size() < 2)
+      {
+        throw ClusterFunctor::InsufficientInput(__FILE__, __LINE__, __PRETTY_FUNCTION__, "Data to cluster only contains one element");
+      }
 
-      for (Size i = 0; i < binned_data.size(); i++)
+      std::vector<SingleLinkage::Edge> edges;
+      bool failed = false;
+      Size failed_i = 0, failed_j = 0;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
       {
-        for (Size j = 0; j < i; j++)
+        std::vector<SingleLinkage::Edge> local_edges;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16) nowait
+#endif
+        for (SignedSize i = 1; i < (SignedSize)data.size(); i++)
         {
-          //distance value is 1-similarity value, since similarity is in range of [0,1]
-          original_distance.setValue(i, j, 1 - comparator(binned_data[i], binned_data[j]));
+          for (Size j = 0; j < (Size)i; j++)
+          {
+            Real distance(0);
+            try
+            {
+              //distance value is 1-similarity value, since similarity is in range of [0,1]
+              distance = 1 - comparator(data[i], data[j]);
+            }
+            catch (...)
+            {
+#ifdef _OPENMP
+#pragma omp critical (ClusterHierarchical_failed)
+#endif
+              if (!failed || (Size)i < failed_i)
+              {
+                failed = true;
+                failed_i = i;
+                failed_j = j;
+              }
+              break;
+            }
+            if (distance < threshold_)
+            {
+              local_edges.push_back(SingleLinkage::Edge(distance, (UInt)j, (UInt)i));
+            }
+          }
         }
+#ifdef _OPENMP
+#pragma omp critical (ClusterHierarchical_edges)
+#endif
+        edges.insert(edges.end(), local_edges.begin(), local_edges.end());
+      }
+      if (failed)
+      {
+        // exceptions cannot leave the parallel region, rethrow the first one here
+        comparator(data[failed_i], data[failed_j]);
       }
 
-      // create Clustering with ClusterMethod, DistanceMatrix and Data
-      clusterer(original_distance, cluster_tree, threshold_);
+      SingleLinkage()(data.size(), edges, cluster_tree);
     }
 
     /// get the threshold
@@ -187,6 +255,53 @@ public:
       threshold_ = x;
     }
 
+protected:
+
+    /**
+        @brief fills the lower triangle of @p distance with 1 - similarity of the elements of @p data
+
+        The rows are computed in parallel. Exceptions of @p comparator are rethrown after the parallel region.
+        The minimal element of @p distance is not updated.
+    */
+    template <typename Data, typename SimilarityComparator>
+    void fillDistanceMatrix_(const std::vector<Data> & data, const SimilarityComparator & comparator, DistanceMatrix<Real> & distance) const
+    {
+      bool failed = false;
+      Size failed_i = 0, failed_j = 0;
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+      for (SignedSize i = 1; i < (SignedSize)data.size(); i++)
+      {
+        for (Size j = 0; j < (Size)i; j++)
+        {
+          try
+          {
+            //distance value is 1-similarity value, since similarity is in range of [0,1]
+            distance.setValueQuick(i, j, 1 - comparator(data[i], data[j]));
+          }
+          catch (...)
+          {
+#ifdef _OPENMP
+#pragma omp critical (ClusterHierarchical_failed)
+#endif
+            if (!failed || (Size)i < failed_i)
+            {
+              failed = true;
+              failed_i = i;
+              failed_j = j;
+            }
+            break;
+          }
+        }
+      }
+      if (failed)
+      {
+        // exceptions cannot leave the parallel region, rethrow the first one here
+        comparator(data[failed_i], data[failed_j]);
+      }
+    }
+
   };
 
   /** @brief Exception thrown if clustering is attempted without a normalized compare functor
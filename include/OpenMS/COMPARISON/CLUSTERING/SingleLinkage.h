@@ -60,6 +60,31 @@ namespace OpenMS
   {
 public:
 
+    /// an edge of a sparse distance graph, i.e. the distance of two elements
+    struct Edge
+    {
+      /// constructor
+      Edge(Real d, UInt f, UInt s) :
+        distance(d), first(f), second(s)
+      {
+      }
+
+      /// orders by distance, ties are resolved by the element indices
+      bool operator<(const Edge & rhs) const
+      {
+        if (distance != rhs.distance) return distance < rhs.distance;
+        if (second != rhs.second) return second < rhs.second;
+        return first < rhs.first;
+      }
+
+      /// the distance of the elements
+      Real distance;
+      /// index of the first element
+      UInt first;
+      /// index of the second element
+      UInt second;
+    };
+
     /// default constructor
     SingleLinkage();
 
@@ -84,6 +109,19 @@ public:
     */
     void operator()(DistanceMatrix<Real> & original_distance, std::vector<BinaryTreeNode> & cluster_tree, const Real threshold = 1) const;
 
+    /**
+        @brief clusters @p size elements connected by the edges of a sparse distance graph
+
+    @param size the number of elements to be clustered
+    @param edges the distances of related elements, will be sorted during clustering process
+    @param cluster_tree vector< BinaryTreeNode >, represents the clustering, like in the DistanceMatrix version
+    @throw ClusterFunctor::InsufficientInput thrown if @p size is <2
+        The single linkage clustering is the minimum spanning forest of the graph (Kruskal), so the memory needed is linear in the number of edges.
+        For the distances given in @p edges the result is the same as on the full DistanceMatrix. Clusters that are not connected by an edge are merged in
+        dummy clustering steps (distance -1) at the end of @p cluster_tree, as done by CompleteLinkage or AverageLinkage above their threshold.
+    */
+    void operator()(Size size, std::vector<Edge> & edges, std::vector<BinaryTreeNode> & cluster_tree) const;
+
     /// creates a new instance of a SingleLinkage object
     static ClusterFunctor * create()
     {
@@ -96,6 +134,11 @@ public:
       return "SingleLinkage";
     }
 
+protected:
+
+    /// returns the smallest element of the cluster containing element @p i, @p parent is the union-find forest of the clusters
+    static Size findCluster_(std::vector<Size> & parent, Size i);
+
   };
 
 
@@ -87,6 +87,17 @@ public:
     /// function call operator, calculates self similarity
     double operator()(const BinnedSpectrum & spec) const;
 
+    /** function call operator, calculates the similarity of @p query to the spectra [@p first, @p last) of @p block
+
+        @param query Spectrum given in a binned representation
+        @param block Spectra to compare @p query with
+        @param first Index of the first spectrum of @p block
+        @param last Index behind the last spectrum of @p block
+        @param scores The similarities (last - first many)
+        @throw IncompatibleBinning is thrown if the binnings of the spectra are not the same
+    */
+    void operator()(const BinnedSpectrum & query, const BinnedSpectrumBlock & block, Size first, Size last, std::vector<double> & scores) const;
+
     ///
     static BinnedSpectrumCompareFunctor * create() { return new BinnedSpectralContrastAngle(); }
 
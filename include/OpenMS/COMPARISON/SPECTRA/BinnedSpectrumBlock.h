@@ -0,0 +1,177 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Mathias Walzer $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_COMPARISON_SPECTRA_BINNEDSPECTRUMBLOCK_H
+#define OPENMS_COMPARISON_SPECTRA_BINNEDSPECTRUMBLOCK_H
+
+#include <OpenMS/COMPARISON/SPECTRA/BinnedSpectrum.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+
+  /**
+      @brief A contiguous block of binned spectra for fast one-vs-many comparisons
+
+      The filled bins of all spectra are stored as sorted bin indices and values in two contiguous
+      arrays (compressed sparse rows). Together with the number of bins and the precursor m/z of each spectrum
+      this is all the compare functors need, so a query can be scored against many spectra of the block without
+      touching the SparseVector of each BinnedSpectrum (see e.g. BinnedSpectralContrastAngle).
+
+      For the comparison the query is expanded to a dense vector once (see getDenseBins()),
+      so comparing it to a block spectrum is linear in the number of filled bins of the block spectrum.
+
+      All spectra of a block have the same bin size and bin spread.
+
+      @see BinnedSpectrum @see BinnedSpectrumCompareFunctor
+
+      @ingroup SpectraComparison
+  */
+  class OPENMS_DLLAPI BinnedSpectrumBlock
+  {
+
+public:
+
+    /// default constructor
+    BinnedSpectrumBlock();
+
+    /// destructor
+    virtual ~BinnedSpectrumBlock();
+
+    /**
+        @brief appends the bins of @p spectrum
+
+        The first spectrum defines bin size and bin spread of the block.
+
+        @throw BinnedSpectrumCompareFunctor::IncompatibleBinning is thrown if the binning of @p spectrum differs from the block
+        @throw BinnedSpectrum::NoSpectrumIntegrated is thrown if @p spectrum has no bins
+    */
+    void push_back(const BinnedSpectrum & spectrum);
+
+    /// removes all spectra
+    void clear();
+
+    /// returns the number of spectra
+    Size size() const
+    {
+      return bin_numbers_.size();
+    }
+
+    /// returns if the block contains no spectra
+    bool empty() const
+    {
+      return bin_numbers_.empty();
+    }
+
+    /// returns the bin size of the spectra
+    double getBinSize() const
+    {
+      return bin_size_;
+    }
+
+    /// returns the bin spread of the spectra
+    UInt getBinSpread() const
+    {
+      return bin_spread_;
+    }
+
+    /// returns if @p spectrum can be compared to the spectra of the block (always true for an empty block)
+    bool checkCompliance(const BinnedSpectrum & spectrum) const;
+
+    /// returns the number of bins of spectrum @p index (see BinnedSpectrum::getBinNumber())
+    UInt getBinNumber(Size index) const
+    {
+      return bin_numbers_[index];
+    }
+
+    /// returns the number of filled bins of spectrum @p index (see BinnedSpectrum::getFilledBinNumber())
+    UInt getFilledBinNumber(Size index) const
+    {
+      return (UInt)(offsets_[index + 1] - offsets_[index]);
+    }
+
+    /// returns the precursor m/z of spectrum @p index (0 if the spectrum has no precursor)
+    DoubleReal getPrecursorMZ(Size index) const
+    {
+      return precursor_mz_[index];
+    }
+
+    /// returns the sorted indices of the filled bins of spectrum @p index (getFilledBinNumber() many)
+    const UInt * getBinIndices(Size index) const
+    {
+      return bin_indices_.empty() ? 0 : &bin_indices_[0] + offsets_[index];
+    }
+
+    /// returns the values of the filled bins of spectrum @p index (getFilledBinNumber() many)
+    const Real * getBinValues(Size index) const
+    {
+      return bin_values_.empty() ? 0 : &bin_values_[0] + offsets_[index];
+    }
+
+    /**
+        @brief stores the sorted indices and values of the filled bins of @p spectrum in @p indices and @p values
+
+        @throw BinnedSpectrum::NoSpectrumIntegrated is thrown if @p spectrum has no bins
+    */
+    static void getSparseBins(const BinnedSpectrum & spectrum, std::vector<UInt> & indices, std::vector<Real> & values);
+
+    /**
+        @brief stores all bins of @p spectrum (BinnedSpectrum::getBinNumber() many) in @p bins
+
+        @throw BinnedSpectrum::NoSpectrumIntegrated is thrown if @p spectrum has no bins
+    */
+    static void getDenseBins(const BinnedSpectrum & spectrum, std::vector<Real> & bins);
+
+protected:
+
+    /// bin size of the spectra
+    double bin_size_;
+    /// bin spread of the spectra
+    UInt bin_spread_;
+    /// start of the bins of each spectrum in bin_indices_ and bin_values_ (size() + 1 many)
+    std::vector<UInt64> offsets_;
+    /// indices of the filled bins
+    std::vector<UInt> bin_indices_;
+    /// values of the filled bins
+    std::vector<Real> bin_values_;
+    /// number of bins of each spectrum
+    std::vector<UInt> bin_numbers_;
+    /// precursor m/z of each spectrum
+    std::vector<DoubleReal> precursor_mz_;
+
+  };
+
+}
+#endif // OPENMS_COMPARISON_SPECTRA_BINNEDSPECTRUMBLOCK_H
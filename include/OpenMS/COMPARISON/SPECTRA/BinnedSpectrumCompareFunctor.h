@@ -40,9 +40,11 @@
 #include <OpenMS/COMPARISON/SPECTRA/BinnedSpectrum.h>
 
 #include <cmath>
+#include <vector>
 
 namespace OpenMS
 {
+  class BinnedSpectrumBlock;
 
   /**
 
@@ -95,6 +97,16 @@ public:
     /// function call operator, calculates self similarity
     virtual double operator()(const BinnedSpectrum & spec) const = 0;
 
+    /**
+        @brief calculates the similarity of @p query to the spectra [@p first, @p last) of @p block
+
+        The result is the same as calling the pairwise operator for each of these spectra,
+        the similarities are stored in @p scores (in the order of the spectra).
+
+        @throw IncompatibleBinning is thrown if the binning of @p query and @p block is not the same
+    */
+    virtual void operator()(const BinnedSpectrum & query, const BinnedSpectrumBlock & block, Size first, Size last, std::vector<double> & scores) const = 0;
+
     /// registers all derived products
     static void registerChildren();
 
@@ -37,6 +37,7 @@
 
 #include <OpenMS/COMPARISON/SPECTRA/PeakSpectrumCompareFunctor.h>
 #include <OpenMS/COMPARISON/SPECTRA/BinnedSpectrum.h>
+#include <OpenMS/COMPARISON/SPECTRA/BinnedSpectrumBlock.h>
 
 namespace OpenMS
 {
@@ -88,6 +89,12 @@ public:
         @brief: calculates the dot product of the two spectra
     */
     DoubleReal operator()(const BinnedSpectrum & bin1, const BinnedSpectrum & bin2)   const;
+    /**
+        @brief: calculates the dot products of @p query and the spectra [@p first, @p last) of @p block
+
+        Use transform() to create the binned spectra of the query and the block.
+    */
+    void operator()(const BinnedSpectrum & query, const BinnedSpectrumBlock & block, Size first, Size last, std::vector<DoubleReal> & scores) const;
     /**
         @brief: calculates the dot product of itself
     */
@@ -40,6 +40,7 @@
 #include <OpenMS/DATASTRUCTURES/Param.h>
 
 #include <iostream>
+#include <vector>
 
 namespace OpenMS
 {
@@ -55,6 +56,18 @@ namespace OpenMS
  note that \f$ 10^9*60*60*24*365*100 / 2^{64} \doteq 0.17 \f$,
  so it is unlikely you will see one in your lifetime.)
 
+ Inside OpenMP parallel regions, every thread of the (outermost) team draws
+ from its own random stream, so no locking is required on the hot path.
+ The per-thread streams are seeded deterministically from the global seed
+ and the thread index, i.e. the ids produced by thread @em i are
+ reproducible once setSeed() has been called.  Serial code (and nested
+ parallel regions) use the global stream, which yields exactly the same
+ sequence of ids as before.  Per-thread streams require OpenMP 3.0; with
+ older versions the (locked) global stream is used everywhere.
+
+ If many ids are needed at once, getUniqueIds() fills a whole block with a
+ single access to the stream.
+
  @ingroup Concept
  */
   class OPENMS_DLLAPI UniqueIdGenerator
@@ -66,6 +79,16 @@ public:
     static UInt64
     getUniqueId();
 
+    /**
+      @brief Fills @p ids with @p count new unique ids
+
+      The ids are drawn from the stream of the calling thread in one go,
+      which is considerably cheaper than calling getUniqueId() repeatedly.
+      The previous content of @p ids is replaced.
+    */
+    static void
+    getUniqueIds(std::vector<UInt64> & ids, Size count);
+
     /// Initializes random generator using the given DateTime instead of DateTime::now().  This is intended for debugging and testing.
     static void
     setSeed(const DateTime &);
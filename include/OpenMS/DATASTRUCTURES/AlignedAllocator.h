@@ -0,0 +1,183 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Stephan Aiche $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_DATASTRUCTURES_ALIGNEDALLOCATOR_H
+#define OPENMS_DATASTRUCTURES_ALIGNEDALLOCATOR_H
+
+#include <OpenMS/config.h>
+#include <OpenMS/CONCEPT/Types.h>
+
+#include <cstdlib>
+#include <limits>
+#include <new>
+
+#ifdef OPENMS_WINDOWSPLATFORM
+#include <malloc.h>
+#endif
+
+namespace OpenMS
+{
+  /**
+    @brief STL allocator returning memory aligned to @p Alignment bytes.
+
+    Used for the contiguous numeric arrays of e.g. SoASpectrum, so that the
+    compiler can use aligned SIMD loads and stores in tight loops.
+    @p Alignment must be a power of two and a multiple of sizeof(void*).
+
+    @code
+std::vector<double, AlignedAllocator<double> > values(1000);
+    @endcode
+
+    @ingroup Datastructures
+  */
+  template <typename T, Size Alignment = 64>
+  class AlignedAllocator
+  {
+public:
+    typedef T value_type;
+    typedef T * pointer;
+    typedef const T * const_pointer;
+    typedef T & reference;
+    typedef const T & const_reference;
+    typedef std::size_t size_type;
+    typedef std::ptrdiff_t difference_type;
+
+    template <typename U>
+    struct rebind
+    {
+      typedef AlignedAllocator<U, Alignment> other;
+    };
+
+    /// Default constructor
+    AlignedAllocator()
+    {
+    }
+
+    /// Copy constructor
+    AlignedAllocator(const AlignedAllocator &)
+    {
+    }
+
+    /// Converting copy constructor
+    template <typename U>
+    AlignedAllocator(const AlignedAllocator<U, Alignment> &)
+    {
+    }
+
+    /// Destructor
+    ~AlignedAllocator()
+    {
+    }
+
+    pointer address(reference x) const
+    {
+      return &x;
+    }
+
+    const_pointer address(const_reference x) const
+    {
+      return &x;
+    }
+
+    /// Allocates uninitialized, aligned storage for @p n objects
+    pointer allocate(size_type n, const void * /* hint */ = 0)
+    {
+      if (n == 0)
+      {
+        return 0;
+      }
+      if (n > max_size())
+      {
+        throw std::bad_alloc();
+      }
+      void * p = 0;
+#ifdef OPENMS_WINDOWSPLATFORM
+      p = _aligned_malloc(n * sizeof(T), Alignment);
+#else
+      if (posix_memalign(&p, Alignment, n * sizeof(T)) != 0)
+      {
+        p = 0;
+      }
+#endif
+      if (p == 0)
+      {
+        throw std::bad_alloc();
+      }
+      return static_cast<pointer>(p);
+    }
+
+    /// Releases storage obtained from allocate()
+    void deallocate(pointer p, size_type /* n */)
+    {
+#ifdef OPENMS_WINDOWSPLATFORM
+      _aligned_free(p);
+#else
+      std::free(p);
+#endif
+    }
+
+    size_type max_size() const
+    {
+      return std::numeric_limits<size_type>::max() / sizeof(T);
+    }
+
+    void construct(pointer p, const_reference value)
+    {
+      new (static_cast<void *>(p))T(value);
+    }
+
+    void destroy(pointer p)
+    {
+      p->~T();
+    }
+
+  };
+
+  /// All AlignedAllocator instances are interchangeable
+  template <typename T, typename U, Size Alignment>
+  inline bool operator==(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &)
+  {
+    return true;
+  }
+
+  /// All AlignedAllocator instances are interchangeable
+  template <typename T, typename U, Size Alignment>
+  inline bool operator!=(const AlignedAllocator<T, Alignment> &, const AlignedAllocator<U, Alignment> &)
+  {
+    return false;
+  }
+
+} // namespace OpenMS
+
+#endif // OPENMS_DATASTRUCTURES_ALIGNEDALLOCATOR_H
@@ -0,0 +1,346 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Erhan Kenar $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_DATASTRUCTURES_FLATSET_H
+#define OPENMS_DATASTRUCTURES_FLATSET_H
+
+#include <OpenMS/config.h>
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace OpenMS
+{
+  /**
+    @brief A set that stores its elements in a sorted vector.
+
+    The interface and the semantics follow @p std::set (unique keys ordered by
+    @p Compare, constant iterators, the first of several equivalent elements
+    wins on insertion), but the elements are kept in one contiguous block of
+    memory. Compared to a node-based @p std::set this saves the per-element
+    node overhead and gives good locality when iterating.
+
+    Insertion and erasure are linear in the size of the set (except for
+    appending in sorted order, which is amortized constant), so this container
+    is meant for many small sets that are mostly built once and then read, like
+    the feature handles of a ConsensusFeature. Ranges are inserted in
+    O((n + m) log m).
+
+    @note Unlike for @p std::set, inserting or erasing elements invalidates
+    iterators (and references) to the elements of the set.
+
+    @ingroup Datastructures
+  */
+  template <typename Key, typename Compare = std::less<Key> >
+  class FlatSet
+  {
+protected:
+    typedef std::vector<Key> ContainerType_;
+
+public:
+    ///@name Type definitions
+    //@{
+    typedef Key key_type;
+    typedef Key value_type;
+    typedef Compare key_compare;
+    typedef Compare value_compare;
+    typedef typename ContainerType_::size_type size_type;
+    typedef typename ContainerType_::difference_type difference_type;
+    typedef typename ContainerType_::const_reference reference;
+    typedef typename ContainerType_::const_reference const_reference;
+    typedef typename ContainerType_::const_pointer pointer;
+    typedef typename ContainerType_::const_pointer const_pointer;
+    /// Iterators are constant, since modifying an element could break the ordering (as for @p std::set)
+    typedef typename ContainerType_::const_iterator iterator;
+    typedef typename ContainerType_::const_iterator const_iterator;
+    typedef typename ContainerType_::const_reverse_iterator reverse_iterator;
+    typedef typename ContainerType_::const_reverse_iterator const_reverse_iterator;
+    //@}
+
+    ///@name Constructors
+    //@{
+    /// Default constructor
+    FlatSet() :
+      data_(), comp_()
+    {
+    }
+
+    /// Constructor with comparator
+    explicit FlatSet(const Compare & comp) :
+      data_(), comp_(comp)
+    {
+    }
+
+    /// Constructor from a range of elements
+    template <typename InputIterator>
+    FlatSet(InputIterator first, InputIterator last, const Compare & comp = Compare()) :
+      data_(), comp_(comp)
+    {
+      insert(first, last);
+    }
+    //@}
+
+    ///@name Iterators
+    //@{
+    const_iterator begin() const
+    {
+      return data_.begin();
+    }
+
+    const_iterator end() const
+    {
+      return data_.end();
+    }
+
+    const_reverse_iterator rbegin() const
+    {
+      return data_.rbegin();
+    }
+
+    const_reverse_iterator rend() const
+    {
+      return data_.rend();
+    }
+    //@}
+
+    ///@name Capacity
+    //@{
+    bool empty() const
+    {
+      return data_.empty();
+    }
+
+    size_type size() const
+    {
+      return data_.size();
+    }
+
+    size_type max_size() const
+    {
+      return data_.max_size();
+    }
+
+    size_type capacity() const
+    {
+      return data_.capacity();
+    }
+
+    /// Reserves memory for @p n elements
+    void reserve(size_type n)
+    {
+      data_.reserve(n);
+    }
+
+    /// Releases unused memory
+    void shrink_to_fit()
+    {
+      if (data_.capacity() > data_.size())
+      {
+        ContainerType_(data_).swap(data_);
+      }
+    }
+    //@}
+
+    ///@name Modifiers
+    //@{
+    /**
+      @brief Inserts @p value, unless an equivalent element is already contained
+
+      Returns an iterator to the inserted (or already contained) element and whether insertion took place.
+    */
+    std::pair<iterator, bool> insert(const value_type & value)
+    {
+      // fast path for insertion in sorted order:
+      if (data_.empty() || comp_(data_.back(), value))
+      {
+        data_.push_back(value);
+        return std::make_pair(iterator(data_.end() - 1), true);
+      }
+      typename ContainerType_::iterator pos = std::lower_bound(data_.begin(), data_.end(), value, comp_);
+      if (!comp_(value, *pos)) // equivalent element exists
+      {
+        return std::make_pair(iterator(pos), false);
+      }
+      return std::make_pair(iterator(data_.insert(pos, value)), true);
+    }
+
+    /// Inserts @p value (the position hint is ignored)
+    iterator insert(const_iterator /* hint */, const value_type & value)
+    {
+      return insert(value).first;
+    }
+
+    /// Inserts all elements in the range that are not contained yet
+    template <typename InputIterator>
+    void insert(InputIterator first, InputIterator last)
+    {
+      // copy first - the range may point into this set:
+      ContainerType_ values(first, last);
+      if (values.empty())
+      {
+        return;
+      }
+      const size_type old_size = data_.size();
+      std::stable_sort(values.begin(), values.end(), comp_);
+      data_.insert(data_.end(), values.begin(), values.end());
+      // stable: existing elements stay in front of equivalent new ones
+      std::inplace_merge(data_.begin(), data_.begin() + old_size, data_.end(), comp_);
+      data_.erase(std::unique(data_.begin(), data_.end(), Equivalent_(comp_)), data_.end());
+    }
+
+    /// Removes the element at @p pos
+    void erase(const_iterator pos)
+    {
+      data_.erase(data_.begin() + (pos - begin()));
+    }
+
+    /// Removes the elements in the range [@p first, @p last)
+    void erase(const_iterator first, const_iterator last)
+    {
+      data_.erase(data_.begin() + (first - begin()), data_.begin() + (last - begin()));
+    }
+
+    /// Removes the element equivalent to @p key (if any) and returns the number of removed elements
+    size_type erase(const key_type & key)
+    {
+      typename ContainerType_::iterator pos = std::lower_bound(data_.begin(), data_.end(), key, comp_);
+      if (pos == data_.end() || comp_(key, *pos))
+      {
+        return 0;
+      }
+      data_.erase(pos);
+      return 1;
+    }
+
+    void swap(FlatSet & rhs)
+    {
+      data_.swap(rhs.data_);
+      std::swap(comp_, rhs.comp_);
+    }
+
+    void clear()
+    {
+      data_.clear();
+    }
+    //@}
+
+    ///@name Lookup
+    //@{
+    const_iterator find(const key_type & key) const
+    {
+      const_iterator pos = lower_bound(key);
+      if (pos == end() || comp_(key, *pos))
+      {
+        return end();
+      }
+      return pos;
+    }
+
+    size_type count(const key_type & key) const
+    {
+      return (find(key) == end()) ? 0 : 1;
+    }
+
+    const_iterator lower_bound(const key_type & key) const
+    {
+      return std::lower_bound(data_.begin(), data_.end(), key, comp_);
+    }
+
+    const_iterator upper_bound(const key_type & key) const
+    {
+      return std::upper_bound(data_.begin(), data_.end(), key, comp_);
+    }
+
+    std::pair<const_iterator, const_iterator> equal_range(const key_type & key) const
+    {
+      return std::equal_range(data_.begin(), data_.end(), key, comp_);
+    }
+
+    key_compare key_comp() const
+    {
+      return comp_;
+    }
+
+    value_compare value_comp() const
+    {
+      return comp_;
+    }
+    //@}
+
+    ///@name Comparison operators (lexicographic, as for @p std::set)
+    //@{
+    bool operator==(const FlatSet & rhs) const
+    {
+      return data_ == rhs.data_;
+    }
+
+    bool operator!=(const FlatSet & rhs) const
+    {
+      return !(data_ == rhs.data_);
+    }
+
+    bool operator<(const FlatSet & rhs) const
+    {
+      return data_ < rhs.data_;
+    }
+    //@}
+
+protected:
+    /// Equivalence in terms of the ordering (for adjacent elements in sorted order)
+    struct Equivalent_
+    {
+      explicit Equivalent_(const Compare & comp) :
+        comp_(comp)
+      {
+      }
+
+      bool operator()(const Key & left, const Key & right) const
+      {
+        return !comp_(left, right) && !comp_(right, left);
+      }
+
+      Compare comp_;
+    };
+
+    /// The sorted elements
+    ContainerType_ data_;
+    /// The ordering
+    Compare comp_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_DATASTRUCTURES_FLATSET_H
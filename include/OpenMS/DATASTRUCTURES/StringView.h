@@ -0,0 +1,151 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Stephan Aiche $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_DATASTRUCTURES_STRINGVIEW_H
+#define OPENMS_DATASTRUCTURES_STRINGVIEW_H
+
+#include <OpenMS/DATASTRUCTURES/String.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace OpenMS
+{
+  /**
+    @brief A non-owning view on a sequence of characters
+
+    StringView stores a pointer and a length only. It is used to access large character buffers
+    (e.g. the sequences of a FASTA database) without copying them into String objects.
+
+    @note The viewed characters have to outlive the view. The view is not null-terminated.
+
+    @ingroup Datastructures
+  */
+  class StringView
+  {
+public:
+    /// Default constructor (empty view)
+    StringView() :
+      begin_(0),
+      size_(0)
+    {
+    }
+
+    /// Constructor for a view on @p size characters starting at @p begin
+    StringView(const char * begin, Size size) :
+      begin_(begin),
+      size_(size)
+    {
+    }
+
+    /// Constructor for a view on the characters of @p s
+    StringView(const std::string & s) :
+      begin_(s.data()),
+      size_(s.size())
+    {
+    }
+
+    /// Returns a pointer to the first character
+    const char * begin() const
+    {
+      return begin_;
+    }
+
+    /// Returns a pointer behind the last character
+    const char * end() const
+    {
+      return begin_ + size_;
+    }
+
+    /// Returns the number of characters
+    Size size() const
+    {
+      return size_;
+    }
+
+    /// Returns if the view is empty
+    bool empty() const
+    {
+      return size_ == 0;
+    }
+
+    /// Returns the character at position @p i
+    char operator[](Size i) const
+    {
+      return begin_[i];
+    }
+
+    /// Returns a view on @p length characters starting at @p start (clipped to the end of this view)
+    StringView substr(Size start, Size length) const
+    {
+      if (start > size_) start = size_;
+      return StringView(begin_ + start, std::min(length, size_ - start));
+    }
+
+    /// Returns a copy of the characters
+    String toString() const
+    {
+      return String(begin_, size_);
+    }
+
+    /// Equality operator
+    bool operator==(const StringView & rhs) const
+    {
+      return size_ == rhs.size_ && (size_ == 0 || std::memcmp(begin_, rhs.begin_, size_) == 0);
+    }
+
+    /// Inequality operator
+    bool operator!=(const StringView & rhs) const
+    {
+      return !(*this == rhs);
+    }
+
+    /// Lexicographical less-than operator (like std::string)
+    bool operator<(const StringView & rhs) const
+    {
+      const Size length = std::min(size_, rhs.size_);
+      const int cmp = length == 0 ? 0 : std::memcmp(begin_, rhs.begin_, length);
+      return cmp < 0 || (cmp == 0 && size_ < rhs.size_);
+    }
+
+protected:
+    /// First character
+    const char * begin_;
+    /// Number of characters
+    Size size_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_DATASTRUCTURES_STRINGVIEW_H
@@ -4,6 +4,7 @@ set(directory include/OpenMS/DATASTRUCTURES)
 ### list all header files of the directory here
 set(sources_list_h
 Adduct.h
+AlignedAllocator.h
 BigString.h
 BinaryTreeNode.h
 ChargePair.h
@@ -24,6 +25,7 @@ DateTime.h
 DefaultParamHandler.h
 DistanceMatrix.h
 DoubleList.h
+FlatSet.h
 GridFeature.h
 IntList.h
 IsotopeCluster.h
@@ -36,6 +38,7 @@ SeqanIncludeWrapper.h
 SparseVector.h
 String.h
 StringList.h
+StringView.h
 SuffixArray.h
 SuffixArrayPeptideFinder.h
 SuffixArraySeqan.h
@@ -114,6 +114,12 @@ public:
         return label;
     }
 
+    /// mass traces of the isotope pattern (pointing to the traces passed to FeatureFindingMetabo::run)
+    const std::vector<MassTrace *> & getMassTraces() const
+    {
+        return iso_pattern_;
+    }
+
     std::vector<String> getLabels()
     {
         std::vector<String> tmp_labels;
@@ -126,7 +132,7 @@ public:
         return tmp_labels;
     }
 
-    DoubleReal getScore()
+    DoubleReal getScore() const
     {
         return feat_score_;
     }
@@ -213,7 +219,7 @@ class OPENMS_DLLAPI CmpHypothesesByScore
 {
 public:
 
-    bool operator()(FeatureHypothesis x, FeatureHypothesis y) const
+    bool operator()(const FeatureHypothesis & x, const FeatureHypothesis & y) const
     {
         return x.getScore() > y.getScore();
     }
@@ -267,6 +273,8 @@ private:
     // DoubleReal scoreTraceSim_(MassTrace, MassTrace);
     // DoubleReal scoreIntRatio_(DoubleReal, DoubleReal, Size);
     void findLocalFeatures_(std::vector<MassTrace *> &, std::vector<FeatureHypothesis> &);
+    /// generate the hypotheses for the traces [first_idx, last_idx) of the (m/z sorted) traces
+    void findHypotheses_(std::vector<MassTrace> &, Size, Size, std::vector<FeatureHypothesis> &);
 
 
     /// parameter stuff
@@ -38,6 +38,7 @@
 
 
 #include <OpenMS/FILTERING/NOISEESTIMATION/SignalToNoiseEstimator.h>
+#include <OpenMS/KERNEL/SoASpectrum.h>
 #include <OpenMS/CONCEPT/LogStream.h>
 #include <OpenMS/CONCEPT/Exception.h>
 #include <vector>
@@ -157,6 +158,171 @@ public:
     virtual ~SignalToNoiseEstimatorMedian()
     {}
 
+    /**
+      @brief Computes the S/N ratio of all data points of @p spectrum
+
+      Uses the same algorithm and parameters as init(), but works on the arrays of a
+      SoASpectrum and stores the results in @p stn (one value per peak, in peak order)
+      instead of the peak-keyed map used by getSignalToNoise().  The histogram bin of every
+      data point is computed in a separate, vectorizable pass before the sliding window
+      sweep.  This method does not change the state of the estimator.
+
+      @exception Throws Exception::InvalidValue
+    */
+    template <typename MZType>
+    void computeSTN(const SoASpectrum<MZType> & spectrum, std::vector<double> & stn) const
+    {
+      const Size size = spectrum.size();
+      stn.assign(size, 0.0);
+      if (size == 0) return;
+
+      const MZType * mz = &spectrum.getMZArray()[0];
+      const Real * intensity = &spectrum.getIntensityArray()[0];
+
+      // maximal range of histogram needs to be calculated first
+      double max_intensity = max_intensity_;
+      if (auto_mode_ == AUTOMAXBYSTDEV)
+      {
+        // use MEAN+auto_max_intensity_*STDEV as threshold
+        double m = 0;
+        for (Size i = 0; i < size; ++i)
+        {
+          m += intensity[i];
+        }
+        m = m / size;
+        double v = 0;
+        for (Size i = 0; i < size; ++i)
+        {
+          const double tmp = m - intensity[i];
+          v += tmp * tmp;
+        }
+        v = v / size;
+        max_intensity = m + std::sqrt(v) * auto_max_stdev_Factor_;
+      }
+      else if (auto_mode_ == AUTOMAXBYPERCENT)
+      {
+        // get value at "auto_max_percentile_"th percentile
+        if ((auto_max_percentile_ < 0) || (auto_max_percentile_ > 100))
+        {
+          String s = auto_max_percentile_;
+          throw Exception::InvalidValue(__FILE__,
+                                        __LINE__,
+                                        __PRETTY_FUNCTION__,
+                                        "auto_mode is on AUTOMAXBYPERCENT! auto_max_percentile is not in [0,100]. Use setAutoMaxPercentile(<value>) to change it!",
+                                        s);
+        }
+        Real max_int = 0;
+        for (Size i = 0; i < size; ++i)
+        {
+          max_int = std::max(max_int, intensity[i]);
+        }
+        double bin_size = max_int / 100;
+        std::vector<int> histogram_auto(100, 0);
+        for (Size i = 0; i < size; ++i)
+        {
+          ++histogram_auto[std::max(std::min<int>((int)((intensity[i] - 1) / bin_size), 99), 0)];
+        }
+        // add up element counts in histogram until ?th percentile is reached
+        int elements_below_percentile = (int) (auto_max_percentile_ * size / 100);
+        int elements_seen = 0;
+        int i = -1;
+        while (i < 99 && i + 1 < (int)size && elements_seen < elements_below_percentile)
+        {
+          ++i;
+          elements_seen += histogram_auto[i];
+        }
+        max_intensity = (((double)i) + 0.5) * bin_size;
+      }
+      else //if (auto_mode_ == MANUAL)
+      {
+        if (max_intensity <= 0)
+        {
+          String s = max_intensity;
+          throw Exception::InvalidValue(__FILE__,
+                                        __LINE__,
+                                        __PRETTY_FUNCTION__,
+                                        "auto_mode is on MANUAL! max_intensity is <=0. Needs to be positive! Use setMaxIntensity(<value>) or enable auto_mode!",
+                                        s);
+        }
+      }
+
+      if (!checkMaxIntensity_(max_intensity))
+      {
+        return;
+      }
+
+      const double window_half_size = win_len_ / 2;
+      const double bin_size = std::max(1.0, max_intensity / bin_count_); // at least size of 1 for intensity bins
+      const int bin_count_minus_1 = bin_count_ - 1;
+
+      // histogram bin of every data point
+      std::vector<int> to_bin(size);
+      for (Size i = 0; i < size; ++i)
+      {
+        to_bin[i] = std::max(std::min<int>((int)(intensity[i] / bin_size), bin_count_minus_1), 0);
+      }
+
+      std::vector<int> histogram(bin_count_, 0);
+      std::vector<double> bin_value(bin_count_, 0);
+      // calculate average intensity that is represented by a bin
+      for (int bin = 0; bin < bin_count_; bin++)
+      {
+        bin_value[bin] = (bin + 0.5) * bin_size;
+      }
+
+      double sparse_window_percent = 0;
+      double histogram_oob_percent = 0;
+      int elements_in_window = 0;
+      Size border_left = 0;
+      Size border_right = 0;
+
+      for (Size center = 0; center < size; ++center)
+      {
+        // erase all elements from histogram that will leave the window on the LEFT side
+        while (mz[border_left] < mz[center] - window_half_size)
+        {
+          --histogram[to_bin[border_left]];
+          --elements_in_window;
+          ++border_left;
+        }
+        // add all elements to histogram that will enter the window on the RIGHT side
+        while (border_right != size && mz[border_right] <= mz[center] + window_half_size)
+        {
+          ++histogram[to_bin[border_right]];
+          ++elements_in_window;
+          ++border_right;
+        }
+
+        double noise;
+        if (elements_in_window < min_required_elements_)
+        {
+          noise = noise_for_empty_window_;
+          ++sparse_window_percent;
+        }
+        else
+        {
+          // find bin i where ceil[elements_in_window/2] <= sum_c(0..i){ histogram[c] }
+          int median_bin = -1;
+          int element_inc_count = 0;
+          const int element_in_window_half = (elements_in_window + 1) / 2;
+          while (median_bin < bin_count_minus_1 && element_inc_count < element_in_window_half)
+          {
+            ++median_bin;
+            element_inc_count += histogram[median_bin];
+          }
+          // increase the error count
+          if (median_bin == bin_count_minus_1) {++histogram_oob_percent; }
+          // just avoid division by 0
+          noise = std::max(1.0, bin_value[median_bin]);
+        }
+        stn[center] = intensity[center] / noise;
+      }
+
+      sparse_window_percent = sparse_window_percent * 100 / size;
+      histogram_oob_percent = histogram_oob_percent * 100 / size;
+      warnAboutWindows_(sparse_window_percent, histogram_oob_percent);
+    }
+
 
 protected:
 
@@ -248,9 +414,8 @@ protected:
         }
       }
 
-      if (max_intensity_ < 0)
+      if (!checkMaxIntensity_(max_intensity_))
       {
-        std::cerr << "TODO SignalToNoiseEstimatorMedian: the max_intensity_ value should be positive! " << max_intensity_ << std::endl;
         return;
       }
 
@@ -363,6 +528,25 @@ protected:
       sparse_window_percent = sparse_window_percent * 100 / window_count;
       histogram_oob_percent = histogram_oob_percent * 100 / window_count;
 
+      warnAboutWindows_(sparse_window_percent, histogram_oob_percent);
+
+    } // end of shiftWindow_
+
+    /// Returns if @p max_intensity can be used for the histogram (and warns if it cannot)
+    bool checkMaxIntensity_(double max_intensity) const
+    {
+      if (max_intensity < 0)
+      {
+        LOG_WARN << "WARNING in SignalToNoiseEstimatorMedian: the max_intensity value should be positive, but is "
+                 << max_intensity << ". No Signal-to-Noise estimates are computed!" << std::endl;
+        return false;
+      }
+      return true;
+    }
+
+    /// Warns if too many windows were sparse or too many median estimates fell into the rightmost histogram bin (both in percent)
+    void warnAboutWindows_(double sparse_window_percent, double histogram_oob_percent) const
+    {
       // warn if percentage of sparse windows is above 20%
       if (sparse_window_percent > 20)
       {
@@ -371,7 +555,6 @@ protected:
                  << "% of all windows were sparse. You should consider increasing 'win_len' or decreasing 'min_required_elements'"
                  << std::endl;
       }
-
       // warn if percentage of possibly wrong median estimates is above 1%
       if (histogram_oob_percent > 1)
       {
@@ -381,8 +564,7 @@ protected:
                  << "You should consider increasing 'max_intensity' (and maybe 'bin_count' with it, to keep bin width reasonable)"
                  << std::endl;
       }
-
-    } // end of shiftWindow_
+    }
 
     /// overridden function from DefaultParamHandler to keep members up to date, when a parameter is changed
     void updateMembers_()
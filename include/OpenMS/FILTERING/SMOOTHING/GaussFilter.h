@@ -39,6 +39,7 @@
 #include <OpenMS/CONCEPT/ProgressLogger.h>
 #include <OpenMS/CONCEPT/Constants.h>
 #include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/KERNEL/SoAExperiment.h>
 #include <OpenMS/FILTERING/SMOOTHING/GaussFilterAlgorithm.h>
 
 #include <cmath>
@@ -182,8 +183,80 @@ public:
       endProgress();
     }
 
+    /**
+      @brief Smoothes a SoASpectrum containing profile data.
+
+      Same as filter(MSSpectrum&), but uses the vectorizable array kernel
+      GaussFilterAlgorithm::filterArrays().
+
+        @exception Exception::IllegalArgument is thrown, if the @em gaussian_width parameter is too small.
+    */
+    template <typename MZType>
+    void filter(SoASpectrum<MZType> & spectrum)
+    {
+      filter_(gauss_algo_, spectrum);
+    }
+
+    /**
+      @brief Smoothes all spectra of a SoAExperiment containing profile data.
+
+      The spectra are processed in parallel (if OpenMP is enabled).
+
+        @exception Exception::IllegalArgument is thrown, if the @em gaussian_width parameter is too small.
+    */
+    template <typename MZType>
+    void filterExperiment(SoAExperiment<MZType> & map)
+    {
+      startProgress(0, map.size(), "smoothing data");
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+      {
+        // the algorithm is not thread-safe in ppm mode (it re-initializes its coefficients)
+        GaussFilterAlgorithm gauss_algo(gauss_algo_);
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic, 16)
+#endif
+        for (SignedSize i = 0; i < (SignedSize)map.size(); ++i)
+        {
+          filter_(gauss_algo, map[i]);
+        }
+      }
+      endProgress();
+    }
+
 protected:
 
+    /// Smoothes @p spectrum using the array kernel of @p gauss_algo
+    template <typename MZType>
+    void filter_(GaussFilterAlgorithm & gauss_algo, SoASpectrum<MZType> & spectrum) const
+    {
+      const Size data_size = spectrum.size();
+      if (data_size == 0) return;
+
+      typename SoASpectrum<MZType>::IntensityArray int_out(data_size);
+      bool found_signal = gauss_algo.filterArrays(&spectrum.getMZArray()[0], &spectrum.getIntensityArray()[0], &int_out[0], data_size);
+
+      // If all intensities are zero in the scan and the scan has a reasonable size, throw an exception.
+      // This is the case if the gaussian filter is smaller than the spacing of raw data
+      if (!found_signal && data_size >= 3)
+      {
+        String error_message = "Found no signal. The gaussian width is probably smaller than the spacing in your profile data. Try to use a bigger width.";
+        if (spectrum.getRT() > 0.0)
+        {
+          error_message += String(" The error occured in the spectrum with retention time ") + spectrum.getRT() + ".\n";
+        }
+#ifdef _OPENMP
+#pragma omp critical (GaussFilter_error)
+#endif
+        std::cerr << error_message;
+      }
+      else
+      {
+        spectrum.getIntensityArray().swap(int_out);
+      }
+    }
+
     GaussFilterAlgorithm gauss_algo_;
 
     /// The spacing of the pre-tabulated kernel coefficients
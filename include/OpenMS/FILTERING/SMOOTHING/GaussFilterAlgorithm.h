@@ -39,6 +39,7 @@
 #include <OpenMS/CONCEPT/Constants.h>
 #include <OpenMS/INTERFACES/DataStructures.h>
 #include <OpenMS/INTERFACES/ISpectrumAccess.h>
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
@@ -162,6 +163,71 @@ public:
       return found_signal;
     }
 
+    /**
+      @brief Smoothes contiguous m/z and intensity arrays of @p size data points.
+
+      Computes the same convolution as filter(), but works on plain arrays (e.g. those of a
+      SoASpectrum).  The kernel weights of a window are computed first and the trapezoidal
+      integration is done in a separate loop over the arrays, so both loops can be vectorized
+      by the compiler.  Results may differ from filter() in the last digits due to the
+      different order of summation.
+
+      @return true if any smoothed intensity is non-zero
+    */
+    template <typename MZType, typename IntensityType>
+    bool filterArrays(const MZType * mz, const IntensityType * int_in, IntensityType * int_out, Size size)
+    {
+      bool found_signal = false;
+      std::vector<DoubleReal> weights;
+
+      for (Size i = 0; i < size; ++i)
+      {
+        const DoubleReal x = mz[i];
+        // if ppm tolerance is used, calculate a reasonable width value for this m/z
+        if (use_ppm_tolerance_)
+        {
+          initialize(x * ppm_tolerance_ * 10e-6, spacing_, ppm_tolerance_, use_ppm_tolerance_);
+        }
+        const Size middle = coeffs_.size();
+        const DoubleReal start_pos = std::max(x - middle * spacing_, (DoubleReal)mz[0]);
+        const DoubleReal end_pos = std::min(x + middle * spacing_, (DoubleReal)mz[size - 1]);
+
+        // window of data points contributing to the integral (same bounds as integrate_())
+        Size first = i;
+        while (first > 0 && mz[first - 1] > start_pos) --first;
+        Size last = i;
+        while (last + 1 < size && mz[last + 1] < end_pos) ++last;
+
+        // interpolated kernel weight of each data point in the window
+        const Size window_size = last - first + 1;
+        weights.resize(window_size);
+        for (Size k = 0; k < window_size; ++k)
+        {
+          const DoubleReal position = fabs(x - mz[first + k]) / spacing_;
+          const Size left = std::min((Size)position, middle - 1);
+          const DoubleReal d = position - left;
+          weights[k] = (left + 1 < middle) ? (1 - d) * coeffs_[left] + d * coeffs_[left + 1] : coeffs_[left];
+        }
+
+        // trapezoidal integration of kernel and kernel * signal
+        DoubleReal norm = 0.;
+        DoubleReal v = 0.;
+        const MZType * mz_w = mz + first;
+        const IntensityType * int_w = int_in + first;
+        for (Size k = 0; k + 1 < window_size; ++k)
+        {
+          const DoubleReal half_step = (mz_w[k + 1] - mz_w[k]) / 2.;
+          norm += half_step * (weights[k] + weights[k + 1]);
+          v += half_step * (int_w[k] * weights[k] + int_w[k + 1] * weights[k + 1]);
+        }
+
+        const DoubleReal new_int = (v > 0) ? v / norm : 0;
+        int_out[i] = (IntensityType)new_int;
+        if (fabs(new_int) > 0) found_signal = true;
+      }
+      return found_signal;
+    }
+
     void initialize(DoubleReal gaussian_width, DoubleReal spacing, DoubleReal ppm_tolerance, bool use_ppm_tolerance);
 
 protected:
@@ -36,6 +36,7 @@
 #define OPENMS_FILTERING_TRANSFORMERS_LINEARRESAMPLERALIGN_H
 
 #include <OpenMS/FILTERING/TRANSFORMERS/LinearResampler.h>
+#include <OpenMS/KERNEL/SoASpectrum.h>
 
 namespace OpenMS
 {
@@ -134,6 +135,47 @@ public:
     resampled_peak_container.swap(spectrum);
   }
 
+	/** 
+		@brief Applies the resampling algorithm to a SoASpectrum.
+
+    Produces the same result as raster(MSSpectrum&), but distributes the intensities by
+    computing the grid position of every raw data point directly instead of walking two
+    iterators in parallel.
+	*/
+  template <typename MZType>
+  void raster(SoASpectrum<MZType>& spectrum)
+  {
+    //return if nothing to do
+    if (spectrum.empty()) return;
+
+    const typename SoASpectrum<MZType>::MZArray& mz = spectrum.getMZArray();
+    rasterArrays_(spectrum, 0, spectrum.size(), mz.front(), mz.back());
+  }
+
+	/** 
+		@brief Applies the resampling algorithm to a SoASpectrum but it will be aligned between start_pos and end_pos
+	*/
+  template <typename MZType>
+  void raster_align(SoASpectrum<MZType>& spectrum, double start_pos, double end_pos)
+  {
+    //return if nothing to do
+    if (spectrum.empty()) return;
+    if (end_pos < start_pos)
+    {
+      spectrum.clear();
+      return;
+    }
+
+    // get the indices just before / after the two points start_pos / end_pos
+    const typename SoASpectrum<MZType>::MZArray& mz = spectrum.getMZArray();
+    Size first = 0;
+    Size last = mz.size();
+    while (first != mz.size() && mz[first] < start_pos) {++first;}
+    while (last != first && mz[last - 1] > end_pos) {--last;}
+
+    rasterArrays_(spectrum, first, last, start_pos, end_pos);
+  }
+
 	/** 
 		@brief Applies the resampling algorithm to an MSSpectrum.
 	*/
@@ -204,6 +246,51 @@ public:
 
   }
 
+protected:
+
+  /// Resamples the raw data points [first, last) of @p spectrum onto the grid start_pos + i*spacing_ (up to end_pos) and replaces the peaks of @p spectrum with the result
+  template <typename MZType>
+  void rasterArrays_(SoASpectrum<MZType>& spectrum, Size first, Size last, double start_pos, double end_pos)
+  {
+    const int number_resampled_points = (int)(ceil((end_pos -start_pos) / spacing_ + 1));
+    const SignedSize last_point = number_resampled_points - 1;
+
+    typename SoASpectrum<MZType>::MZArray resampled_mz(number_resampled_points);
+    typename SoASpectrum<MZType>::IntensityArray resampled_int(number_resampled_points, 0);
+
+    // generate the resampled positions origin+i*spacing_
+    for (int i = 0; i < number_resampled_points; ++i)
+    {
+      resampled_mz[i] = (MZType)(start_pos + i*spacing_);
+    }
+
+    const MZType* raw_mz = &spectrum.getMZArray()[0];
+    const Real* raw_int = &spectrum.getIntensityArray()[0];
+    for (Size k = first; k < last; ++k)
+    {
+      const double position = (raw_mz[k] - start_pos) / spacing_;
+      // points left of the first / right of the last resampled position contribute to it completely
+      if (position <= 0)
+      {
+        resampled_int[0] += raw_int[k];
+        continue;
+      }
+      const SignedSize left = (SignedSize)position;
+      if (left >= last_point)
+      {
+        resampled_int[last_point] += raw_int[k];
+        continue;
+      }
+      // distribute the intensity of the raw point according to the distance to the two adjacent resampled points
+      const double d = position - left;
+      resampled_int[left] += raw_int[k] * (1 - d);
+      resampled_int[left + 1] += raw_int[k] * d;
+    }
+
+    spectrum.getMZArray().swap(resampled_mz);
+    spectrum.getIntensityArray().swap(resampled_int);
+  }
+
   };
 
 }
@@ -229,13 +229,12 @@ public:
 
         SpectraDistance_ llc;
         llc.setParameters(param_.copy("precursor_method:", true));
-        SingleLinkage sl;
-        DistanceMatrix<Real> dist;         // will be filled
         ClusterHierarchical ch;
 
         //ch.setThreshold(0.99);
-        // clustering ; threshold is implicitly at 1.0, i.e. distances of 1.0 (== similiarity 0) will not be clustered
-        ch.cluster<BaseFeature, SpectraDistance_>(data, llc, sl, tree, dist);
+        // single linkage clustering ; threshold is implicitly at 1.0, i.e. distances of 1.0 (== similiarity 0) will not be clustered
+        // only the distances below the threshold are kept, so no full distance matrix is needed
+        ch.clusterSparse<BaseFeature, SpectraDistance_>(data, llc, tree);
       }
 
       // extract the clusters
@@ -0,0 +1,193 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Sandro Andreotti $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_FORMAT_FASTAARENA_H
+#define OPENMS_FORMAT_FASTAARENA_H
+
+#include <OpenMS/FORMAT/FASTAFile.h>
+#include <OpenMS/DATASTRUCTURES/StringView.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Fast FASTA reader which stores all entries in one contiguous buffer
+
+    The FASTA file is mapped into memory and split into chunks at record boundaries ('>' at the
+    beginning of a line). The chunks are parsed in parallel (if OpenMP is enabled). Identifiers,
+    descriptions and sequences (without whitespaces) of all entries are stored in a single
+    character buffer and accessed as StringView objects. Identifier and description are split
+    at the first whitespace of the header line, as in FASTAFile.
+
+    Additionally, an index of the identifiers is built, which allows to find entries by
+    identifier (see findIdentifier()).
+
+    For repeated runs on large databases, the parsed entries and the index can be stored in a
+    binary cache file (see loadCached()). The cache is machine dependent and is rebuilt if
+    the FASTA file changes (according to its size and modification time).
+
+    @ingroup FileIO
+  */
+  class OPENMS_DLLAPI FASTAArena
+  {
+public:
+    /// Default constructor
+    FASTAArena();
+
+    /// Destructor
+    virtual ~FASTAArena();
+
+    /**
+      @brief Loads the FASTA file @p filename
+
+      Files with MacOS line endings ('\\r' only) are not supported: a warning is issued and no entries are read.
+
+      @exception Exception::FileNotFound is thrown if the file does not exist.
+      @exception Exception::FileNotReadable is thrown if the file cannot be read.
+      @exception Exception::ParseError is thrown if the file does not start with a FASTA header.
+    */
+    void load(const String & filename);
+
+    /**
+      @brief Loads the FASTA file @p filename using the binary cache @p cache_filename
+
+      If the cache exists and was created from the current version of @p filename, it is
+      loaded instead of parsing the FASTA file. Otherwise, the FASTA file is parsed and the cache
+      is (re)created.
+
+      @exception Exception::FileNotFound is thrown if the FASTA file does not exist.
+      @exception Exception::FileNotReadable is thrown if the FASTA file cannot be read.
+      @exception Exception::ParseError is thrown if the FASTA file does not start with a FASTA header.
+      @exception Exception::UnableToCreateFile is thrown if the cache cannot be written.
+
+      @return true if the cache was used
+    */
+    bool loadCached(const String & filename, const String & cache_filename);
+
+    /**
+      @brief Stores the entries and the identifier index in the binary cache @p cache_filename
+
+      The cache is marked as created from the FASTA file @p filename.
+
+      @exception Exception::UnableToCreateFile is thrown if the cache cannot be written.
+    */
+    void storeCache(const String & cache_filename, const String & filename) const;
+
+    /**
+      @brief Loads the binary cache @p cache_filename if it was created from the current version of @p filename
+
+      @return false (and leaves this object empty) if the cache does not exist or is outdated
+    */
+    bool loadCache(const String & cache_filename, const String & filename);
+
+    /// Removes all entries
+    void clear();
+
+    /// Returns the number of entries
+    Size size() const
+    {
+      return entries_.size();
+    }
+
+    /// Returns if there are no entries
+    bool empty() const
+    {
+      return entries_.empty();
+    }
+
+    /// Returns the identifier of entry @p index
+    StringView getIdentifier(Size index) const
+    {
+      return view_(entries_[index].identifier, entries_[index].description);
+    }
+
+    /// Returns the description of entry @p index
+    StringView getDescription(Size index) const
+    {
+      return view_(entries_[index].description, entries_[index].sequence);
+    }
+
+    /// Returns the sequence of entry @p index
+    StringView getSequence(Size index) const
+    {
+      return view_(entries_[index].sequence, index + 1 < entries_.size() ? entries_[index + 1].identifier : text_.size());
+    }
+
+    /// Copies entry @p index to @p entry
+    void getEntry(Size index, FASTAFile::FASTAEntry & entry) const;
+
+    /// Copies all entries to @p entries
+    void getEntries(std::vector<FASTAFile::FASTAEntry> & entries) const;
+
+    /// Returns the index of the entry with identifier @p identifier, or size() if there is none
+    Size findIdentifier(const StringView & identifier) const;
+
+protected:
+    /// Start positions of the parts of an entry in text_ (each part ends where the next one starts)
+    struct Entry
+    {
+      UInt64 identifier;
+      UInt64 description;
+      UInt64 sequence;
+    };
+
+    /**
+      @brief Parses the characters [@p begin, @p end) (complete records)
+
+      The parts of the entries are written to @p text, their positions (shifted by @p text_offset) to @p entries.
+      If @p text is 0, only @p text_size and @p entry_count are computed.
+    */
+    static void parse_(const char * begin, const char * end, char * text, UInt64 text_offset, Entry * entries, Size & text_size, Size & entry_count);
+
+    /// Builds the identifier index
+    void buildIndex_();
+
+    /// Returns a view on text_ from @p begin to @p end
+    StringView view_(UInt64 begin, UInt64 end) const
+    {
+      return StringView(text_.empty() ? 0 : &text_[0] + begin, end - begin);
+    }
+
+    /// Identifiers, descriptions and sequences of all entries
+    std::vector<char> text_;
+    /// Positions of the entries in text_
+    std::vector<Entry> entries_;
+    /// Entry indices sorted by identifier
+    std::vector<UInt64> identifier_index_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_FORMAT_FASTAARENA_H
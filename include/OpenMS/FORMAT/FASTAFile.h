@@ -96,6 +96,9 @@ public:
     /**
       @brief loads a FASTA file given by 'filename' and stores the information in 'data'
 
+      The file is parsed with FASTAArena. Use FASTAArena directly to avoid copying the entries
+      into String objects or to cache large databases.
+
       @exception Exception::FileNotFound is thrown if the file does not exists.
       @exception Exception::ParseError is thrown if the file does not suit to the standard.
     */
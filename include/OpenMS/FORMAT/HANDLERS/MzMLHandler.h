@@ -279,6 +279,8 @@ protected:
       Map<String, std::vector<DataProcessing> > processing_;
       /// id of the default data processing (used when no processing is defined)
       String default_processing_;
+      /// Distinct spectrum meta data seen so far (used if PeakFileOptions::getShareMetadata() is set)
+      std::vector<SpectrumSettings> shared_metadata_;
       //@}
       /**@name temporary data structures to hold written data */
       //@{
@@ -317,6 +319,9 @@ protected:
       /// Fills the current chromatogram with data points and meta data
       void fillChromatogramData_();
 
+      /// Lets the current spectrum share its instrument settings, source file and data processing with previous spectra
+      void shareMetadata_();
+
       /// Handles CV terms
       void handleCVParam_(const String& parent_parent_tag, const String& parent_tag, /*  const String & cvref, */ const String& accession, const String& name, const String& value, const String& unit_accession = "");
 
@@ -829,6 +834,8 @@ protected:
         }
         */
 
+        if (options_.getShareMetadata() && !skip_spectrum_) shareMetadata_();
+
         if (consumer_ != NULL && !skip_spectrum_)
         {
           if (options_.getFillData()) fillData_();
@@ -1134,6 +1141,20 @@ protected:
       }
     }
 
+    template <typename MapType>
+    void MzMLHandler<MapType>::shareMetadata_()
+    {
+      for (Size i = 0; i < shared_metadata_.size(); ++i)
+      {
+        if (spec_.shareMetadata(shared_metadata_[i])) return;
+      }
+      // only few distinct combinations are expected in a file, so the number remembered is limited
+      if (shared_metadata_.size() < 16)
+      {
+        shared_metadata_.push_back(spec_);
+      }
+    }
+
     template <typename MapType>
     void MzMLHandler<MapType>::fillChromatogramData_()
     {
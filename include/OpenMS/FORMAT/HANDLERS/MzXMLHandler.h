@@ -73,7 +73,8 @@ public:
         char_rest_(),
         skip_spectrum_(false),
         spec_write_counter_(1),
-        logger_(logger)
+        logger_(logger),
+        shared_metadata_begin_(0)
       {
         init_();
       }
@@ -88,7 +89,8 @@ public:
         char_rest_(),
         skip_spectrum_(false),
         spec_write_counter_(1),
-        logger_(logger)
+        logger_(logger),
+        shared_metadata_begin_(0)
       {
         init_();
       }
@@ -209,6 +211,15 @@ protected:
       /// data processing auxilary variable
       std::vector<DataProcessing> data_processing_;
 
+      /// spectrum meta data shared by all spectra (used if PeakFileOptions::getShareMetadata() is set)
+      SpectrumSettings shared_metadata_;
+
+      /// index of the first spectrum whose meta data was not shared yet (scans can be nested)
+      Size shared_metadata_begin_;
+
+      /// shares the meta data of all spectra read since the last call (used if PeakFileOptions::getShareMetadata() is set)
+      void shareMetadata_();
+
 private:
       /// Not implemented
       MzXMLHandler();
@@ -743,9 +754,16 @@ private:
 
       static const XMLCh* s_mzxml = xercesc::XMLString::transcode("mzXML");
       static const XMLCh* s_peaks = xercesc::XMLString::transcode("peaks");
+      static const XMLCh* s_scan = xercesc::XMLString::transcode("scan");
 
       open_tags_.pop_back();
 
+      //the meta data of a scan is complete at its end (this also covers the spectra of nested scans)
+      if (options_.getShareMetadata() && equal_(qname, s_scan))
+      {
+        shareMetadata_();
+      }
+
       //abort if this scan should be skipped
       if (skip_spectrum_)
         return;
@@ -822,6 +840,19 @@ private:
       sm_.clear();
     }
 
+    template <typename MapType>
+    void MzXMLHandler<MapType>::shareMetadata_()
+    {
+      for (; shared_metadata_begin_ < exp_->size(); ++shared_metadata_begin_)
+      {
+        SpectrumType & spectrum = exp_->getSpectra()[shared_metadata_begin_];
+        if (!spectrum.shareMetadata(shared_metadata_))
+        {
+          shared_metadata_ = spectrum;
+        }
+      }
+    }
+
     template <typename MapType>
     void MzXMLHandler<MapType>::characters(const XMLCh* const chars, const XMLSize_t /*length*/)
     {
@@ -169,6 +169,22 @@ public:
     /// Whether to write an index at the end of the file (e.g. indexedmzML file format)
     void setWriteIndex(bool write_index);
 
+    /**
+        @name Shared meta data option
+
+        With this option, spectra with equal instrument settings, source file and data processing
+        refer to one shared instance of each of them instead of holding their own copy (see
+        SpectrumSettings::shareMetadata()). This reduces the memory footprint of large maps.
+
+        @note This option is ignored if the format does not support it (only mzML and mzXML do)
+    */
+    //@{
+    ///sets whether or not to share equal spectrum meta data between the spectra
+    void setShareMetadata(bool share);
+    ///returns whether or not to share equal spectrum meta data between the spectra
+    bool getShareMetadata() const;
+    //@}
+
 private:
     bool metadata_only_;
     bool write_supplemental_data_;
@@ -186,6 +202,7 @@ private:
     bool always_append_data_;
     bool fill_data_;
     bool write_index_;
+    bool share_metadata_;
   };
 
 } // namespace OpenMS
@@ -0,0 +1,187 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: David Wojnar $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_FORMAT_SPECTRALLIBRARYINDEX_H
+#define OPENMS_FORMAT_SPECTRALLIBRARYINDEX_H
+
+#include <OpenMS/KERNEL/StandardTypes.h>
+#include <OpenMS/DATASTRUCTURES/StringView.h>
+
+#include <utility>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Compact, precursor-sorted storage of a spectral library
+
+    All peaks of all library spectra are stored in two contiguous arrays (m/z and intensity),
+    the spectra are ordered by precursor m/z and charge. Each spectrum is annotated with its
+    precursor m/z, charge, retention time and peptide sequence (as string, e.g. from AASequence::toString()).
+
+    Candidates for a query are found by binary search on the precursor m/z (see findPrecursorRange()).
+    The peaks of a candidate are copied into a (reusable) PeakSpectrum by getSpectrum().
+
+    A library built from a (preprocessed) MSP file can be stored in a binary cache file (see storeCache()),
+    which is loaded with a few block reads. The cache is machine dependent and is rebuilt if the library
+    file or the preprocessing settings change.
+
+    @ingroup FileIO
+  */
+  class OPENMS_DLLAPI SpectralLibraryIndex
+  {
+public:
+    /// Default constructor
+    SpectralLibraryIndex();
+
+    /// Destructor
+    virtual ~SpectralLibraryIndex();
+
+    /**
+      @brief Appends the peaks of @p spectrum with its annotation
+
+      The retention time is taken from @p spectrum. Call sortByPrecursor() after all spectra were added.
+    */
+    void addSpectrum(const PeakSpectrum & spectrum, DoubleReal precursor_mz, Int charge, const String & sequence);
+
+    /// Sorts the spectra by precursor m/z and charge (stable, i.e. spectra with equal precursor keep their order)
+    void sortByPrecursor();
+
+    /// Removes all spectra
+    void clear();
+
+    /// Returns the number of spectra
+    Size size() const
+    {
+      return entries_.size();
+    }
+
+    /// Returns if there are no spectra
+    bool empty() const
+    {
+      return entries_.empty();
+    }
+
+    /// Returns the number of peaks of all spectra
+    Size getPeakCount() const
+    {
+      return peak_mz_.size();
+    }
+
+    /// Returns the precursor m/z of spectrum @p index
+    DoubleReal getPrecursorMZ(Size index) const
+    {
+      return entries_[index].precursor_mz;
+    }
+
+    /// Returns the precursor charge of spectrum @p index
+    Int getCharge(Size index) const
+    {
+      return entries_[index].charge;
+    }
+
+    /// Returns the retention time of spectrum @p index
+    DoubleReal getRT(Size index) const
+    {
+      return entries_[index].rt;
+    }
+
+    /// Returns the peptide sequence of spectrum @p index
+    StringView getSequence(Size index) const
+    {
+      return StringView(text_.empty() ? 0 : &text_[0] + entries_[index].sequence_offset, entries_[index].sequence_length);
+    }
+
+    /**
+      @brief Copies spectrum @p index into @p spectrum
+
+      All previous peaks and meta data of @p spectrum are removed. The retention time and a precursor with
+      m/z and charge are set. Reusing the same @p spectrum avoids memory allocations.
+    */
+    void getSpectrum(Size index, PeakSpectrum & spectrum) const;
+
+    /**
+      @brief Returns the index range [first, second) of spectra with precursor m/z in [@p min_mz, @p max_mz]
+
+      @note The spectra have to be sorted (see sortByPrecursor()).
+    */
+    std::pair<Size, Size> findPrecursorRange(DoubleReal min_mz, DoubleReal max_mz) const;
+
+    /**
+      @brief Stores the library in the binary cache @p cache_filename
+
+      The cache is marked as created from the library file @p filename with the preprocessing @p settings
+      (an arbitrary string describing all parameters that influence the stored spectra).
+
+      @exception Exception::UnableToCreateFile is thrown if the cache cannot be written.
+    */
+    void storeCache(const String & cache_filename, const String & filename, const String & settings) const;
+
+    /**
+      @brief Loads the binary cache @p cache_filename if it was created from the current version of @p filename with @p settings
+
+      @return false (and leaves this object empty) if the cache does not exist or is outdated
+    */
+    bool loadCache(const String & cache_filename, const String & filename, const String & settings);
+
+protected:
+    /// Annotation and peak range of a spectrum
+    struct Entry
+    {
+      DoubleReal precursor_mz;
+      DoubleReal rt;
+      UInt64 peak_offset;
+      UInt64 sequence_offset;
+      UInt peak_count;
+      UInt sequence_length;
+      Int charge;
+      UInt reserved;
+    };
+
+    /// Compares entries by precursor m/z and charge
+    static bool precursorLess_(const Entry & a, const Entry & b);
+
+    /// The spectra
+    std::vector<Entry> entries_;
+    /// m/z of all peaks
+    std::vector<DoubleReal> peak_mz_;
+    /// Intensities of all peaks
+    std::vector<Real> peak_intensity_;
+    /// Sequences of all spectra
+    std::vector<char> text_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_FORMAT_SPECTRALLIBRARYINDEX_H
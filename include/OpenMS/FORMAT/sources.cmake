@@ -33,6 +33,7 @@ CsvFile.h
 DTA2DFile.h
 DTAFile.h
 EDTAFile.h
+FASTAArena.h
 FASTAFile.h
 FastaIterator.h
 FastaIteratorIntern.h
@@ -71,6 +72,7 @@ ProtXMLFile.h
 SequestInfile.h
 SequestOutfile.h
 SpecArrayFile.h
+SpectralLibraryIndex.h
 SVOutStream.h
 TextFile.h
 ToolDescriptionFile.h
@@ -0,0 +1,289 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Stephan Aiche $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_KERNEL_AREAINDEX_H
+#define OPENMS_KERNEL_AREAINDEX_H
+
+#include <OpenMS/CONCEPT/Types.h>
+#include <OpenMS/CONCEPT/Macros.h>
+
+#include <algorithm>
+#include <iterator>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Acceleration index for RT / m/z area queries on a map of spectra
+
+    For every spectrum, the index stores the retention time, the MS level and the m/z range
+    in contiguous arrays. Additionally, the m/z range of each spectrum is divided into bins of
+    (on average) PEAKS_PER_BIN peaks and the index of the first peak of every bin is stored.
+    Finding the first peak above a given m/z position thus takes a table lookup and a short
+    linear scan instead of a binary search over the peaks.
+
+    The index does not observe the spectra it was built from: it has to be rebuilt whenever
+    the spectra (or their peaks) are changed.
+
+    The spectra have to be sorted by RT and their peaks by m/z.
+
+    @see MSExperiment::areaBeginConst(), MSExperiment::extractXICs()
+
+    @ingroup Kernel
+  */
+  class AreaIndex
+  {
+public:
+    /// Coordinate type
+    typedef DoubleReal CoordinateType;
+
+    /// Average number of peaks per m/z bin
+    static const Size PEAKS_PER_BIN = 8;
+
+    /// Default constructor (creates an empty index)
+    AreaIndex() :
+      rt_(),
+      ms_level_(),
+      min_mz_(),
+      max_mz_(),
+      inverse_bin_width_(),
+      first_bin_(),
+      peak_count_(),
+      bin_offsets_()
+    {
+    }
+
+    /// Builds the index for the spectra in the range [@p begin, @p end)
+    template <typename SpectrumIteratorT>
+    void build(SpectrumIteratorT begin, SpectrumIteratorT end)
+    {
+      clear();
+      const Size spectrum_count = std::distance(begin, end);
+      rt_.reserve(spectrum_count);
+      ms_level_.reserve(spectrum_count);
+      min_mz_.reserve(spectrum_count);
+      max_mz_.reserve(spectrum_count);
+      inverse_bin_width_.reserve(spectrum_count);
+      first_bin_.reserve(spectrum_count + 1);
+      peak_count_.reserve(spectrum_count);
+
+      for (SpectrumIteratorT it = begin; it != end; ++it)
+      {
+        const Size size = it->size();
+        rt_.push_back(it->getRT());
+        ms_level_.push_back(it->getMSLevel());
+        peak_count_.push_back((UInt)size);
+        first_bin_.push_back(bin_offsets_.size());
+        if (size == 0)
+        {
+          min_mz_.push_back(0.0);
+          max_mz_.push_back(0.0);
+          inverse_bin_width_.push_back(0.0);
+          continue;
+        }
+        const CoordinateType min_mz = it->begin()->getMZ();
+        const CoordinateType max_mz = (it->end() - 1)->getMZ();
+        const Size bin_count = size / PEAKS_PER_BIN + 1;
+        min_mz_.push_back(min_mz);
+        max_mz_.push_back(max_mz);
+        inverse_bin_width_.push_back(max_mz > min_mz ? bin_count / (max_mz - min_mz) : 0.0);
+
+        // bin_offsets_[first_bin + b] is the index of the first peak in a bin >= b
+        const Size spectrum_index = ms_level_.size() - 1;
+        Size next_bin = 0;
+        Size peak = 0;
+        for (typename std::iterator_traits<SpectrumIteratorT>::value_type::const_iterator pit = it->begin(); pit != it->end(); ++pit, ++peak)
+        {
+          const Size bin = bin_(spectrum_index, bin_count, pit->getMZ());
+          for (; next_bin <= bin; ++next_bin)
+          {
+            bin_offsets_.push_back((UInt)peak);
+          }
+        }
+        for (; next_bin <= bin_count; ++next_bin)
+        {
+          bin_offsets_.push_back((UInt)size);
+        }
+      }
+      first_bin_.push_back(bin_offsets_.size());
+    }
+
+    /// Removes all data from the index
+    void clear()
+    {
+      rt_.clear();
+      ms_level_.clear();
+      min_mz_.clear();
+      max_mz_.clear();
+      inverse_bin_width_.clear();
+      first_bin_.clear();
+      peak_count_.clear();
+      bin_offsets_.clear();
+    }
+
+    /// Returns the number of indexed spectra
+    Size size() const
+    {
+      return rt_.size();
+    }
+
+    /// Returns if no spectra are indexed
+    bool empty() const
+    {
+      return rt_.empty();
+    }
+
+    /// Swaps the contents of two indices
+    void swap(AreaIndex & rhs)
+    {
+      rt_.swap(rhs.rt_);
+      ms_level_.swap(rhs.ms_level_);
+      min_mz_.swap(rhs.min_mz_);
+      max_mz_.swap(rhs.max_mz_);
+      inverse_bin_width_.swap(rhs.inverse_bin_width_);
+      first_bin_.swap(rhs.first_bin_);
+      peak_count_.swap(rhs.peak_count_);
+      bin_offsets_.swap(rhs.bin_offsets_);
+    }
+
+    /// Returns the index of the first spectrum with RT >= @p rt
+    Size rtBegin(CoordinateType rt) const
+    {
+      return std::lower_bound(rt_.begin(), rt_.end(), rt) - rt_.begin();
+    }
+
+    /// Returns the index of the first spectrum with RT > @p rt
+    Size rtEnd(CoordinateType rt) const
+    {
+      return std::upper_bound(rt_.begin(), rt_.end(), rt) - rt_.begin();
+    }
+
+    /// Returns the retention time of spectrum @p spectrum
+    CoordinateType getRT(Size spectrum) const
+    {
+      return rt_[spectrum];
+    }
+
+    /// Returns the MS level of spectrum @p spectrum
+    UInt getMSLevel(Size spectrum) const
+    {
+      return ms_level_[spectrum];
+    }
+
+    /// Returns the number of peaks of spectrum @p spectrum
+    Size getPeakCount(Size spectrum) const
+    {
+      return peak_count_[spectrum];
+    }
+
+    /// Returns if spectrum @p spectrum contains peaks in the m/z range [@p min_mz, @p max_mz] (according to its bounds)
+    bool overlaps(Size spectrum, CoordinateType min_mz, CoordinateType max_mz) const
+    {
+      return peak_count_[spectrum] != 0 && min_mz <= max_mz_[spectrum] && max_mz >= min_mz_[spectrum];
+    }
+
+    /**
+      @brief Returns the index of the first peak of @p spectrum with m/z >= @p mz (like MSSpectrum::MZBegin())
+
+      @p spectrum_index is the position of @p spectrum in the map the index was built from.
+    */
+    template <typename SpectrumT>
+    Size mzBegin(Size spectrum_index, const SpectrumT & spectrum, CoordinateType mz) const
+    {
+      OPENMS_PRECONDITION(spectrum.size() == peak_count_[spectrum_index], "AreaIndex is not up to date!")
+      const Size size = peak_count_[spectrum_index];
+      if (size == 0 || mz <= min_mz_[spectrum_index]) return 0;
+      if (mz > max_mz_[spectrum_index]) return size;
+
+      const Size first_bin = first_bin_[spectrum_index];
+      const Size bin = bin_(spectrum_index, first_bin_[spectrum_index + 1] - first_bin - 1, mz);
+      Size peak = bin_offsets_[first_bin + bin];
+      const Size last = bin_offsets_[first_bin + bin + 1];
+      while (peak < last && spectrum[peak].getMZ() < mz) ++peak;
+      return peak;
+    }
+
+    /**
+      @brief Returns the index of the first peak of @p spectrum with m/z > @p mz (like MSSpectrum::MZEnd())
+
+      @p spectrum_index is the position of @p spectrum in the map the index was built from.
+    */
+    template <typename SpectrumT>
+    Size mzEnd(Size spectrum_index, const SpectrumT & spectrum, CoordinateType mz) const
+    {
+      OPENMS_PRECONDITION(spectrum.size() == peak_count_[spectrum_index], "AreaIndex is not up to date!")
+      const Size size = peak_count_[spectrum_index];
+      if (size == 0 || mz < min_mz_[spectrum_index]) return 0;
+      if (mz >= max_mz_[spectrum_index]) return size;
+
+      const Size first_bin = first_bin_[spectrum_index];
+      const Size bin = bin_(spectrum_index, first_bin_[spectrum_index + 1] - first_bin - 1, mz);
+      Size peak = bin_offsets_[first_bin + bin];
+      const Size last = bin_offsets_[first_bin + bin + 1];
+      while (peak < last && spectrum[peak].getMZ() <= mz) ++peak;
+      return peak;
+    }
+
+protected:
+
+    /// Returns the m/z bin of @p mz in spectrum @p spectrum (monotonic in @p mz, clamped to [0, bin_count - 1])
+    Size bin_(Size spectrum, Size bin_count, CoordinateType mz) const
+    {
+      const CoordinateType position = (mz - min_mz_[spectrum]) * inverse_bin_width_[spectrum];
+      if (position <= 0.0) return 0;
+      if (position >= (CoordinateType)(bin_count - 1)) return bin_count - 1;
+      return (Size)position;
+    }
+
+    /// Retention times of the spectra
+    std::vector<CoordinateType> rt_;
+    /// MS levels of the spectra
+    std::vector<UInt> ms_level_;
+    /// Smallest m/z of the spectra
+    std::vector<CoordinateType> min_mz_;
+    /// Largest m/z of the spectra
+    std::vector<CoordinateType> max_mz_;
+    /// Number of m/z bins per m/z unit of the spectra
+    std::vector<CoordinateType> inverse_bin_width_;
+    /// Position of the first bin of each spectrum in bin_offsets_ (plus the end position)
+    std::vector<Size> first_bin_;
+    /// Number of peaks of the spectra
+    std::vector<UInt> peak_count_;
+    /// Index of the first peak of each bin (plus the past-the-end index) for all spectra
+    std::vector<UInt> bin_offsets_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_KERNEL_AREAINDEX_H
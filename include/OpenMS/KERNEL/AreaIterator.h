@@ -38,6 +38,7 @@
 // OpenMS includes
 #include <OpenMS/CONCEPT/Types.h>
 #include <OpenMS/KERNEL/PeakIndex.h>
+#include <OpenMS/KERNEL/AreaIndex.h>
 
 // STL includes
 #include <iterator>
@@ -52,6 +53,9 @@ namespace OpenMS
         This iterator allows us to move through the data structure in a linear
         manner i.e. we don't need to jump to the next spectrum manually.
 
+        If an AreaIndex of the spectra is given, it is used to skip spectra and to find the
+        m/z range in each spectrum.
+
         @note This iterator iterates over spectra with MS level 1 only!
     */
     template <class ValueT, class ReferenceT, class PointerT, class SpectrumIteratorT, class PeakIteratorT>
@@ -77,13 +81,14 @@ public:
       typedef unsigned int difference_type;
       //@}
 
-      /// Constructor for the begin iterator
-      AreaIterator(SpectrumIteratorType first, SpectrumIteratorType begin, SpectrumIteratorType end, CoordinateType low_mz, CoordinateType high_mz) :
+      /// Constructor for the begin iterator (@p index has to be built from the spectra starting at @p first, if given)
+      AreaIterator(SpectrumIteratorType first, SpectrumIteratorType begin, SpectrumIteratorType end, CoordinateType low_mz, CoordinateType high_mz, const AreaIndex * index = 0) :
         first_(first),
         current_scan_(begin),
         end_scan_(end),
         low_mz_(low_mz),
         high_mz_(high_mz),
+        index_(index),
         is_end_(false)
       {
         nextScan_();
@@ -98,6 +103,7 @@ public:
         end_peak_(),
         low_mz_(0.0),
         high_mz_(0.0),
+        index_(0),
         is_end_(true)
       {}
 
@@ -114,6 +120,7 @@ public:
         end_peak_(rhs.end_peak_),
         low_mz_(rhs.low_mz_),
         high_mz_(rhs.high_mz_),
+        index_(rhs.index_),
         is_end_(rhs.is_end_)
       {}
 
@@ -133,6 +140,7 @@ public:
           end_peak_ = rhs.end_peak_;
           low_mz_ = rhs.low_mz_;
           high_mz_ = rhs.high_mz_;
+          index_ = rhs.index_;
         }
 
         return *this;
@@ -218,6 +226,11 @@ private:
       //Advances to the iterator to the next valid peak in the next valid spectrum
       void nextScan_()
       {
+        if (index_ != 0)
+        {
+          nextIndexedScan_();
+          return;
+        }
         while (true)
         {
           //if (current_scan_ != end_scan_) std::cout << "RT: " << current_scan_->getRT() << std::endl;
@@ -240,6 +253,26 @@ private:
         }
       }
 
+      //Same as nextScan_(), but uses the area index
+      void nextIndexedScan_()
+      {
+        Size scan = current_scan_ - first_;
+        for (; current_scan_ != end_scan_; ++current_scan_, ++scan)
+        {
+          if (index_->getMSLevel(scan) != 1 || !index_->overlaps(scan, low_mz_, high_mz_))
+          {
+            continue;
+          }
+          current_peak_ = current_scan_->begin() + index_->mzBegin(scan, *current_scan_, low_mz_);
+          end_peak_ = current_scan_->begin() + index_->mzEnd(scan, *current_scan_, high_mz_);
+          if (current_peak_ != end_peak_)
+          {
+            return;
+          }
+        }
+        is_end_ = true;
+      }
+
       /// Iterator to the first scan of the map (needed to calculate the index)
       SpectrumIteratorType first_;
       /// Iterator to the current spectrum
@@ -254,6 +287,8 @@ private:
       CoordinateType low_mz_;
       /// high m/z boundary
       CoordinateType high_mz_;
+      /// Optional acceleration index of the spectra
+      const AreaIndex * index_;
       /// Flag that indicates that this iterator is the end iterator
       bool is_end_;
 
@@ -36,6 +36,7 @@
 #define OPENMS_KERNEL_CONSENSUSFEATURE_H
 
 #include <OpenMS/DATASTRUCTURES/DRange.h>
+#include <OpenMS/DATASTRUCTURES/FlatSet.h>
 #include <OpenMS/KERNEL/BaseFeature.h>
 #include <OpenMS/KERNEL/FeatureHandle.h>
 #include <OpenMS/KERNEL/FeatureMap.h>
@@ -52,6 +53,11 @@ namespace OpenMS
     FeatureHandle instances.  Each ConsensusFeature "contains" zero or more
     FeatureHandles.
 
+    The handles are stored in a FlatSet (a sorted vector with the interface of
+    @p std::set), which keeps large consensus maps compact in memory. Note that
+    adding handles invalidates iterators to the handles of the same
+    ConsensusFeature.
+
     @see ConsensusMap
 
     @ingroup Kernel
@@ -62,7 +68,7 @@ namespace OpenMS
 public:
     ///Type definitions
     //@{
-    typedef std::set<FeatureHandle, FeatureHandle::IndexLess> HandleSetType;
+    typedef FlatSet<FeatureHandle, FeatureHandle::IndexLess> HandleSetType;
     typedef HandleSetType::const_iterator const_iterator;
     typedef HandleSetType::iterator iterator;
     typedef HandleSetType::const_reverse_iterator const_reverse_iterator;
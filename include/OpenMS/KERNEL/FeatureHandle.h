@@ -126,8 +126,8 @@ public:
       @brief Override (most of all) constness.
 
       We provide this such that you can modify instances FeatureHandle which are
-      stored within a ConsensusFeature.  Note that std::set does not provide
-      non-const iterators, because these could be used to change the relative
+      stored within a ConsensusFeature.  Note that std::set (and FlatSet, which
+      is used by ConsensusFeature) does not provide non-const iterators, because these could be used to change the relative
       ordering of the elements, and iterators are (by design/concept) unaware of
       their containers.  Since ConsensusFeature uses the ordering by IndexLess
       (which see), you <i>must not</i> modify the map index of element index if
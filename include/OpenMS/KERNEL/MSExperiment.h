@@ -42,6 +42,7 @@
 #include <OpenMS/FORMAT/DB/PersistentObject.h>
 #include <OpenMS/CONCEPT/Exception.h>
 #include <OpenMS/KERNEL/AreaIterator.h>
+#include <OpenMS/KERNEL/AreaIndex.h>
 
 #include <vector>
 #include <algorithm>
@@ -391,6 +392,86 @@ public:
       return upper_bound(spectra_.begin(), spectra_.end(), s, typename SpectrumType::RTLess());
     }
 
+    /**
+      @brief Returns a non-mutable area iterator for @p area that uses an acceleration index
+
+      The spectra outside the m/z range are skipped by their bounds and the peak ranges are looked
+      up in @p index (see AreaIndex). This pays off if many (small) areas are queried.
+
+      @note @p index has to be built from the spectra of this experiment (AreaIndex::build()) and
+      rebuilt whenever the spectra or their peaks are changed. It is not updated automatically.
+    */
+    ConstAreaIterator areaBeginConst(CoordinateType min_rt, CoordinateType max_rt, CoordinateType min_mz, CoordinateType max_mz, const AreaIndex & index) const
+    {
+      OPENMS_PRECONDITION(min_rt <= max_rt, "Swapped RT range boundaries!")
+      OPENMS_PRECONDITION(min_mz <= max_mz, "Swapped MZ range boundaries!")
+      OPENMS_PRECONDITION(this->isSorted(true), "Experiment is not sorted by RT and m/z! Using ConstAreaIterator will give invalid results!")
+      OPENMS_PRECONDITION(index.size() == spectra_.size(), "The area index was not built from the spectra of this experiment!")
+      return ConstAreaIterator(spectra_.begin(), spectra_.begin() + index.rtBegin(min_rt), spectra_.begin() + index.rtEnd(max_rt), min_mz, max_mz, &index);
+    }
+
+    /**
+      @brief Extracts ion chromatograms for a batch of RT / m/z windows
+
+      For each window of @p windows, @p xics contains a chromatogram with one data point per
+      MS1 spectrum in the RT range of the window. The data points hold the retention time and
+      the summed intensity of the peaks in the m/z range of the window. The first dimension
+      of the windows is RT, the second m/z (as for getDataRange()).
+
+      The windows are processed in parallel (if OpenMP is enabled). If many windows are queried,
+      pass an AreaIndex built from the spectra of this experiment as @p index to speed up the
+      queries (see areaBeginConst()).
+
+      @note Make sure the spectra are sorted with respect to retention time and m/z!
+    */
+    void extractXICs(const std::vector<AreaType> & windows, std::vector<ChromatogramType> & xics, const AreaIndex * index = 0) const
+    {
+      OPENMS_PRECONDITION(this->isSorted(true), "Experiment is not sorted by RT and m/z! Extracted XICs will be invalid!")
+      OPENMS_PRECONDITION(index == 0 || index->size() == spectra_.size(), "The area index was not built from the spectra of this experiment!")
+      xics.clear();
+      xics.resize(windows.size());
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+      for (SignedSize w = 0; w < (SignedSize)windows.size(); ++w)
+      {
+        const CoordinateType min_mz = windows[w].minY();
+        const CoordinateType max_mz = windows[w].maxY();
+        const Size begin = (index != 0) ? index->rtBegin(windows[w].minX()) : RTBegin(windows[w].minX()) - spectra_.begin();
+        const Size end = (index != 0) ? index->rtEnd(windows[w].maxX()) : RTEnd(windows[w].maxX()) - spectra_.begin();
+
+        ChromatogramType & xic = xics[w];
+        xic.reserve(end - begin);
+        for (Size s = begin; s < end; ++s)
+        {
+          const SpectrumType & spectrum = spectra_[s];
+          if (spectrum.getMSLevel() != 1) continue;
+
+          Size first, last;
+          if (index != 0)
+          {
+            first = index->mzBegin(s, spectrum, min_mz);
+            last = index->mzEnd(s, spectrum, max_mz);
+          }
+          else
+          {
+            first = spectrum.MZBegin(min_mz) - spectrum.begin();
+            last = spectrum.MZEnd(max_mz) - spectrum.begin();
+          }
+          DoubleReal intensity = 0.0;
+          for (Size p = first; p < last; ++p)
+          {
+            intensity += spectrum[p].getIntensity();
+          }
+          ChromatogramPeakType peak;
+          peak.setRT(spectrum.getRT());
+          peak.setIntensity(intensity);
+          xic.push_back(peak);
+        }
+      }
+    }
+
     //@}
 
     /**
@@ -0,0 +1,151 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Stephan Aiche $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_KERNEL_SOAEXPERIMENT_H
+#define OPENMS_KERNEL_SOAEXPERIMENT_H
+
+#include <OpenMS/KERNEL/SoASpectrum.h>
+#include <OpenMS/KERNEL/MSExperiment.h>
+#include <OpenMS/CONCEPT/Exception.h>
+
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Adaptor holding the spectra of an MSExperiment as SoASpectrum instances.
+
+    The conversion from and to MSExperiment runs in parallel over the spectra
+    (if OpenMP is enabled).  Only the peaks, retention times and MS levels are
+    held by this class, the experiment itself keeps all other meta data.
+    The intended usage is to convert once, run one or more array based
+    kernels and write the result back:
+
+    @code
+MSExperiment<> exp; // ... filled with profile data
+SoAExperiment<> arrays(exp);
+gauss_filter.filterExperiment(arrays);
+arrays.copyTo(exp);
+    @endcode
+
+    @ingroup Kernel
+  */
+  template <typename MZType = DoubleReal>
+  class SoAExperiment :
+    public std::vector<SoASpectrum<MZType> >
+  {
+public:
+
+    /// Spectrum type
+    typedef SoASpectrum<MZType> SpectrumType;
+    /// STL base class type
+    typedef std::vector<SpectrumType> Base;
+
+    /// Default constructor
+    SoAExperiment() :
+      Base()
+    {
+    }
+
+    /// Conversion constructor, copies the peaks of all spectra of @p experiment
+    template <typename PeakT>
+    explicit SoAExperiment(const MSExperiment<PeakT> & experiment) :
+      Base()
+    {
+      assign(experiment);
+    }
+
+    /// Copy constructor
+    SoAExperiment(const SoAExperiment & source) :
+      Base(source)
+    {
+    }
+
+    /// Destructor
+    ~SoAExperiment()
+    {
+    }
+
+    /// Assignment operator
+    SoAExperiment & operator=(const SoAExperiment & source)
+    {
+      if (&source == this) return *this;
+
+      Base::operator=(source);
+      return *this;
+    }
+
+    /// Replaces the content with the spectra of @p experiment
+    template <typename PeakT>
+    void assign(const MSExperiment<PeakT> & experiment)
+    {
+      this->resize(experiment.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+      for (SignedSize i = 0; i < (SignedSize)experiment.size(); ++i)
+      {
+        (*this)[i].assign(experiment[i]);
+      }
+    }
+
+    /**
+      @brief Writes the peaks of all spectra back to @p experiment
+
+      @p experiment must contain as many spectra as this instance, usually it is the experiment
+      this instance was created from.  See SoASpectrum::copyTo() for details.
+
+      @exception Exception::IllegalArgument is thrown if the number of spectra differs
+    */
+    template <typename PeakT>
+    void copyTo(MSExperiment<PeakT> & experiment) const
+    {
+      if (experiment.size() != this->size())
+      {
+        throw Exception::IllegalArgument(__FILE__, __LINE__, __PRETTY_FUNCTION__, String("Number of spectra differs: ") + this->size() + " vs. " + experiment.size());
+      }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+      for (SignedSize i = 0; i < (SignedSize)experiment.size(); ++i)
+      {
+        (*this)[i].copyTo(experiment[i]);
+      }
+    }
+
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_KERNEL_SOAEXPERIMENT_H
@@ -0,0 +1,330 @@
+// --------------------------------------------------------------------------
+//                   OpenMS -- Open-Source Mass Spectrometry
+// --------------------------------------------------------------------------
+// Copyright The OpenMS Team -- Eberhard Karls University Tuebingen,
+// ETH Zurich, and Freie Universitaet Berlin 2002-2013.
+//
+// This software is released under a three-clause BSD license:
+//  * Redistributions of source code must retain the above copyright
+//    notice, this list of conditions and the following disclaimer.
+//  * Redistributions in binary form must reproduce the above copyright
+//    notice, this list of conditions and the following disclaimer in the
+//    documentation and/or other materials provided with the distribution.
+//  * Neither the name of any author or any participating institution
+//    may be used to endorse or promote products derived from this software
+//    without specific prior written permission.
+// For a full list of authors, refer to the file AUTHORS.
+// --------------------------------------------------------------------------
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL ANY OF THE AUTHORS OR THE CONTRIBUTING
+// INSTITUTIONS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL,
+// EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+// PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS;
+// OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY,
+// WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR
+// OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+// ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+//
+// --------------------------------------------------------------------------
+// $Maintainer: Stephan Aiche $
+// $Authors: $
+// --------------------------------------------------------------------------
+
+#ifndef OPENMS_KERNEL_SOASPECTRUM_H
+#define OPENMS_KERNEL_SOASPECTRUM_H
+
+#include <OpenMS/KERNEL/MSSpectrum.h>
+#include <OpenMS/DATASTRUCTURES/AlignedAllocator.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace OpenMS
+{
+  /**
+    @brief Structure-of-arrays representation of the peaks of a 1D spectrum.
+
+    MSSpectrum stores its peaks as a vector of peak objects (m/z and intensity
+    interleaved).  Numerical kernels such as smoothing, resampling or noise
+    estimation only touch one or two of the coordinates and run much faster
+    on separate, contiguous and aligned arrays, which the compiler can
+    vectorize.  This class holds exactly these two arrays, plus the retention
+    time and MS level of the spectrum.  All other meta data stays with the
+    original MSSpectrum.
+
+    The m/z precision is selectable via @p MZType: use DoubleReal (the default)
+    for full precision or Real to halve the memory bandwidth of m/z-heavy
+    kernels, at the cost of about 0.1 ppm precision at m/z 1000.
+
+    Typical usage:
+    @code
+MSSpectrum<> spectrum; // ... filled with profile data
+SoASpectrum<> arrays(spectrum);
+gauss_filter.filter(arrays);
+arrays.copyTo(spectrum);
+    @endcode
+
+    @see SoAExperiment
+
+    @ingroup Kernel
+  */
+  template <typename MZType = DoubleReal>
+  class SoASpectrum
+  {
+public:
+
+    ///@name Type definitions
+    //@{
+    /// Coordinate (m/z) type
+    typedef MZType CoordinateType;
+    /// Intensity type
+    typedef Real IntensityType;
+    /// Aligned m/z array type
+    typedef std::vector<CoordinateType, AlignedAllocator<CoordinateType> > MZArray;
+    /// Aligned intensity array type
+    typedef std::vector<IntensityType, AlignedAllocator<IntensityType> > IntensityArray;
+    //@}
+
+    /// Default constructor
+    SoASpectrum() :
+      mz_(),
+      intensity_(),
+      retention_time_(-1),
+      ms_level_(1)
+    {
+    }
+
+    /// Conversion constructor, copies the peaks of @p spectrum
+    template <typename PeakT>
+    explicit SoASpectrum(const MSSpectrum<PeakT> & spectrum) :
+      mz_(),
+      intensity_(),
+      retention_time_(-1),
+      ms_level_(1)
+    {
+      assign(spectrum);
+    }
+
+    /// Copy constructor
+    SoASpectrum(const SoASpectrum & source) :
+      mz_(source.mz_),
+      intensity_(source.intensity_),
+      retention_time_(source.retention_time_),
+      ms_level_(source.ms_level_)
+    {
+    }
+
+    /// Destructor
+    ~SoASpectrum()
+    {
+    }
+
+    /// Assignment operator
+    SoASpectrum & operator=(const SoASpectrum & source)
+    {
+      if (&source == this) return *this;
+
+      mz_ = source.mz_;
+      intensity_ = source.intensity_;
+      retention_time_ = source.retention_time_;
+      ms_level_ = source.ms_level_;
+      return *this;
+    }
+
+    /// Equality operator
+    bool operator==(const SoASpectrum & rhs) const
+    {
+      return mz_ == rhs.mz_ &&
+             intensity_ == rhs.intensity_ &&
+             retention_time_ == rhs.retention_time_ &&
+             ms_level_ == rhs.ms_level_;
+    }
+
+    /// Equality operator
+    bool operator!=(const SoASpectrum & rhs) const
+    {
+      return !(operator==(rhs));
+    }
+
+    /// Replaces the content with the peaks, retention time and MS level of @p spectrum
+    template <typename PeakT>
+    void assign(const MSSpectrum<PeakT> & spectrum)
+    {
+      const Size size = spectrum.size();
+      mz_.resize(size);
+      intensity_.resize(size);
+      for (Size i = 0; i < size; ++i)
+      {
+        mz_[i] = (CoordinateType)spectrum[i].getMZ();
+        intensity_[i] = (IntensityType)spectrum[i].getIntensity();
+      }
+      retention_time_ = spectrum.getRT();
+      ms_level_ = spectrum.getMSLevel();
+    }
+
+    /**
+      @brief Writes the peaks back to @p spectrum
+
+      The spectrum is resized to the number of peaks of this instance, then m/z and intensity of
+      all peaks are overwritten.  Retention time, MS level and all other meta data of @p spectrum
+      are left untouched.
+
+      @note If the number of peaks changed (e.g. after resampling), additional peak members of
+      rich peak types and the data arrays of @p spectrum no longer correspond to the peaks.
+    */
+    template <typename PeakT>
+    void copyTo(MSSpectrum<PeakT> & spectrum) const
+    {
+      const Size size = mz_.size();
+      spectrum.resize(size);
+      for (Size i = 0; i < size; ++i)
+      {
+        spectrum[i].setMZ(mz_[i]);
+        spectrum[i].setIntensity(intensity_[i]);
+      }
+    }
+
+    ///@name Peak access
+    //@{
+    /// Returns the number of peaks
+    inline Size size() const
+    {
+      return mz_.size();
+    }
+
+    /// Returns if the spectrum contains no peaks
+    inline bool empty() const
+    {
+      return mz_.empty();
+    }
+
+    /// Resizes both arrays to @p size peaks
+    void resize(Size size)
+    {
+      mz_.resize(size);
+      intensity_.resize(size);
+    }
+
+    /// Reserves space for @p size peaks in both arrays
+    void reserve(Size size)
+    {
+      mz_.reserve(size);
+      intensity_.reserve(size);
+    }
+
+    /// Removes all peaks (retention time and MS level are kept)
+    void clear()
+    {
+      mz_.clear();
+      intensity_.clear();
+    }
+
+    /// Appends a peak
+    inline void push_back(CoordinateType mz, IntensityType intensity)
+    {
+      mz_.push_back(mz);
+      intensity_.push_back(intensity);
+    }
+
+    /// Returns the m/z of peak @p index
+    inline CoordinateType getMZ(Size index) const
+    {
+      return mz_[index];
+    }
+
+    /// Sets the m/z of peak @p index
+    inline void setMZ(Size index, CoordinateType mz)
+    {
+      mz_[index] = mz;
+    }
+
+    /// Returns the intensity of peak @p index
+    inline IntensityType getIntensity(Size index) const
+    {
+      return intensity_[index];
+    }
+
+    /// Sets the intensity of peak @p index
+    inline void setIntensity(Size index, IntensityType intensity)
+    {
+      intensity_[index] = intensity;
+    }
+
+    /// Mutable access to the m/z array
+    inline MZArray & getMZArray()
+    {
+      return mz_;
+    }
+
+    /// Non-mutable access to the m/z array
+    inline const MZArray & getMZArray() const
+    {
+      return mz_;
+    }
+
+    /// Mutable access to the intensity array
+    inline IntensityArray & getIntensityArray()
+    {
+      return intensity_;
+    }
+
+    /// Non-mutable access to the intensity array
+    inline const IntensityArray & getIntensityArray() const
+    {
+      return intensity_;
+    }
+
+    /// Exchanges the peaks, retention time and MS level with @p other in constant time
+    void swap(SoASpectrum & other)
+    {
+      mz_.swap(other.mz_);
+      intensity_.swap(other.intensity_);
+      std::swap(retention_time_, other.retention_time_);
+      std::swap(ms_level_, other.ms_level_);
+    }
+    //@}
+
+    ///@name Meta data
+    //@{
+    /// Returns the absolute retention time (in seconds)
+    inline DoubleReal getRT() const
+    {
+      return retention_time_;
+    }
+
+    /// Sets the absolute retention time (in seconds)
+    inline void setRT(DoubleReal rt)
+    {
+      retention_time_ = rt;
+    }
+
+    /// Returns the MS level
+    inline UInt getMSLevel() const
+    {
+      return ms_level_;
+    }
+
+    /// Sets the MS level
+    inline void setMSLevel(UInt ms_level)
+    {
+      ms_level_ = ms_level;
+    }
+    //@}
+
+protected:
+
+    /// m/z values of the peaks
+    MZArray mz_;
+    /// Intensities of the peaks
+    IntensityArray intensity_;
+    /// Retention time
+    DoubleReal retention_time_;
+    /// MS level
+    UInt ms_level_;
+  };
+
+} // namespace OpenMS
+
+#endif // OPENMS_KERNEL_SOASPECTRUM_H
@@ -3,6 +3,7 @@ set(directory include/OpenMS/KERNEL)
 
 ### list all header files of the directory here
 set(sources_list_h
+AreaIndex.h
 AreaIterator.h
 BaseFeature.h
 ChromatogramPeak.h
@@ -28,6 +29,8 @@ RangeManager.h
 RangeUtils.h
 RichPeak1D.h
 RichPeak2D.h
+SoAExperiment.h
+SoASpectrum.h
 StandardTypes.h
 )
 
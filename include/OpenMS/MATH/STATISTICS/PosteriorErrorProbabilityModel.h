@@ -53,6 +53,7 @@ namespace OpenMS
         @brief Implements a mixture model of the inverse gumbel and the gauss distribution or a gaussian mixture.
 
         This class fits either a Gumbel distribution and a Gauss distribution to a set of data points or two Gaussian distributions using the EM algorithm.
+        The densities and the sums of the E-step are computed in parallel if OpenMP is enabled; the sums are combined in a fixed order, so the fit does not depend on the number of threads.
         One can output the fit as a gnuplot formula using getGumbelGnuplotFormula() and getGaussGnuplotFormula() after fitting.
         @note All paremters are stored in GaussFitResult. In the case of the gumbel distribution x0 and sigma represent the local parameter alpha and the scale parameter beta, respectively.
 
@@ -165,6 +166,16 @@ public:
       }
 
 private:
+      /**
+          @brief Sums the posterior probabilities of the incorrectly assigned distribution, their complements and both weighted with the scores, in one pass.
+
+          Partial sums of blocks of BLOCK_SIZE_ scores are computed in parallel (if OpenMP is enabled) and added up in order afterwards.
+      */
+      void sumPosteriors_(const std::vector<double> & x_scores, const std::vector<DoubleReal> & incorrect_density, const std::vector<DoubleReal> & correct_density, DoubleReal & sum_posterior, DoubleReal & one_minus_sum_posterior, DoubleReal & sum_negative_x0, DoubleReal & sum_positive_x0) const;
+      /// sums the squared deviations from the means, weighted with the posterior probabilities (see sumPosteriors_())
+      void sumSquaredDeviations_(const std::vector<double> & x_scores, const std::vector<DoubleReal> & incorrect_density, const std::vector<DoubleReal> & correct_density, DoubleReal positive_mean, DoubleReal negative_mean, DoubleReal & sum_positive_sigma, DoubleReal & sum_negative_sigma) const;
+      /// number of scores summed up per block in the E-step
+      static const Size BLOCK_SIZE_;
       /// assignment operator (not implemented)
       PosteriorErrorProbabilityModel & operator=(const PosteriorErrorProbabilityModel & rhs);
       ///Copy constructor (not implemented)
@@ -44,6 +44,8 @@
 #include <OpenMS/METADATA/PeptideIdentification.h>
 #include <OpenMS/METADATA/DataProcessing.h>
 
+#include <boost/shared_ptr.hpp>
+
 #include <map>
 #include <vector>
 
@@ -59,6 +61,15 @@ namespace OpenMS
       The precursor spectrum is the first spectrum before this spectrum, that has a lower MS-level than
       the current spectrum.
 
+      The instrument settings, the source file and the data processing are usually identical for
+      many spectra of a map. They are stored as implicitly shared (copy-on-write) instances:
+      copies of a spectrum refer to the same instance until one of them is modified through a
+      mutable accessor. shareMetadata() can be used to make spectra with equal (but separately
+      created) instances share them.
+
+      @note As with all copy-on-write containers, a mutable reference obtained from one of these
+      accessors must not be used after the object has been copied.
+
       @ingroup Metadata
   */
   class OPENMS_DLLAPI SpectrumSettings :
@@ -160,18 +171,31 @@ public:
     /// sets the description of the applied processing
     void setDataProcessing(const std::vector<DataProcessing> & data_processing);
 
+    /**
+      @brief Shares equal instrument settings, source file and data processing with @p other
+
+      Each of the three members that is equal to the corresponding member of @p other is replaced
+      by a reference to the instance of @p other. The content of this object does not change.
+
+      @return @c true if all three members are shared with @p other afterwards
+    */
+    bool shareMetadata(const SpectrumSettings & other);
+
 protected:
 
     SpectrumType type_;
     String native_id_;
     String comment_;
-    InstrumentSettings instrument_settings_;
-    SourceFile source_file_;
+    /// shared instrument settings (null means default-constructed)
+    boost::shared_ptr<InstrumentSettings> instrument_settings_;
+    /// shared source file (null means default-constructed)
+    boost::shared_ptr<SourceFile> source_file_;
     AcquisitionInfo acquisition_info_;
     std::vector<Precursor> precursors_;
     std::vector<Product> products_;
     std::vector<PeptideIdentification> identification_;
-    std::vector<DataProcessing> data_processing_;
+    /// shared data processing (null means empty)
+    boost::shared_ptr<std::vector<DataProcessing> > data_processing_;
   };
 
   ///Print the contents to a stream.
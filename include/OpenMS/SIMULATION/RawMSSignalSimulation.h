@@ -37,6 +37,7 @@
 
 #include <OpenMS/DATASTRUCTURES/DefaultParamHandler.h>
 #include <OpenMS/CONCEPT/ProgressLogger.h>
+#include <OpenMS/INTERFACES/IMSDataConsumer.h>
 
 #include <OpenMS/SIMULATION/SimTypes.h>
 #include <OpenMS/SIMULATION/EGHModel.h>
@@ -54,6 +55,13 @@ namespace OpenMS
    Simulates MS signals for a given set of peptides, with charge annotation,
    given detectabilities, predicted retention times and charge values.
 
+   For LC-MS data, the features are sampled in parallel (if OpenMP is enabled) in blocks along the RT axis.
+   Each feature is sampled into its own buffer, which is already mapped to the m/z sampling grid, and the
+   buffers are added to the scans in a fixed order. A scan is finished (noise is added) as soon as no
+   remaining feature can contribute to it, so it can be handed to a consumer (e.g. written to mzML) right away.
+   All random numbers are drawn from counter-based streams (one per feature and per scan), which are seeded once
+   from the technical random number generator. Thus the result does not depend on the number of threads.
+
    @htmlinclude OpenMS_RawMSSignalSimulation.parameters
 
    @ingroup Simulation
@@ -87,11 +95,67 @@ public:
     /// fill experiment with signals and noise
     void generateRawSignals(FeatureMapSim & features, MSSimExperiment & experiment, MSSimExperiment & experiment_ct, FeatureMapSim & contaminants);
 
+    /**
+      @brief Simulates signals and noise like the function above, but hands each scan to @p consumer as soon as it is finished
+
+      Only the scans which are currently being filled are kept in memory, the others can e.g. be written to
+      disk by a PlainMSDataWritingConsumer. Afterwards, @p experiment contains the scans without peaks
+      (i.e. only their meta data), @p experiment_ct the complete ground truth.
+    */
+    void generateRawSignals(FeatureMapSim & features, MSSimExperiment & experiment, MSSimExperiment & experiment_ct, FeatureMapSim & contaminants, Interfaces::IMSDataConsumer<MSSimExperiment> & consumer);
+
 protected:
 
     enum IONIZATIONMETHOD {IM_ESI = 0, IM_MALDI = 1, IM_ALL = 2};
     enum PROFILESHAPE {RT_RECTANGULAR, RT_GAUSSIAN};
     enum RESOLUTIONMODEL {RES_CONSTANT, RES_LINEAR, RES_SQRT};
+    enum RANDOMSTREAM {RS_FEATURE = 1, RS_SHOT_NOISE, RS_WHITE_NOISE, RS_DETECTOR_NOISE};
+
+    /**
+      @brief Counter-based random number generator
+
+      Each number is a hash of the seed, the stream (e.g. the signal of a feature or the noise of a scan) and its position
+      in the stream. Streams can thus be processed in any order and on any thread and still yield the same numbers.
+    */
+    class CounterRandom_
+    {
+public:
+      /// Constructor
+      CounterRandom_(UInt64 seed, RANDOMSTREAM type, UInt64 index);
+
+      /// uniform random number in (0, 1)
+      DoubleReal uniform();
+      /// Gaussian random number with mean 0
+      DoubleReal gaussian(DoubleReal sigma);
+      /// exponentially distributed random number
+      DoubleReal exponential(DoubleReal mean);
+      /// Poisson distributed random number
+      UInt poisson(DoubleReal mean);
+
+private:
+      UInt64 key_;
+      UInt64 counter_;
+      DoubleReal spare_gaussian_;
+      bool has_spare_gaussian_;
+    };
+
+    /// raw signal point, already mapped to the m/z sampling grid
+    struct GridPoint_
+    {
+      Size scan;
+      UInt bin;
+      SimIntensityType intensity;
+    };
+
+    /// signal of a single feature, which is not yet added to the scans
+    struct FeatureSignal_
+    {
+      std::vector<GridPoint_> raw;
+      std::vector<std::pair<Size, SimPointType> > centroided;
+    };
+
+    /// intensities collected for the bins of the m/z sampling grid (of one scan)
+    typedef std::vector<std::pair<UInt, SimIntensityType> > GridBins_;
 
 
     /// Default constructor
@@ -103,6 +167,9 @@ protected:
     /// Set default parameters
     void setDefaultParams_();
 
+    /// common implementation of generateRawSignals (@p consumer may be null)
+    void generateRawSignals_(FeatureMapSim & features, MSSimExperiment & experiment, MSSimExperiment & experiment_ct, FeatureMapSim & contaminants, Interfaces::IMSDataConsumer<MSSimExperiment> * consumer);
+
     /**
      @brief Add a 1D signal for a single feature
 
@@ -116,10 +183,18 @@ protected:
      @brief Add a 2D signal for a single feature
 
      @param feature The feature which should be simulated
-     @param experiment The experiment to which the simulated signals should be added
-     @param experiment_ct Ground truth for picked peaks
+     @param experiment The experiment providing the scans (their peaks are not touched)
+     @param rnd Random numbers for this feature
+     @param signal The sampled signals (raw and centroided) are added here
      */
-    void add2DSignal_(Feature & feature, MSSimExperiment & experiment, MSSimExperiment & experiment_ct);
+    void add2DSignal_(Feature & feature, const MSSimExperiment & experiment, CounterRandom_ & rnd, FeatureSignal_ & signal);
+
+    /**
+     @brief Create the elution model of a feature and determine the RT range where it is sampled
+
+     The caller takes ownership of the returned model.
+     */
+    EGHModel * createElutionModel_(Feature & feature, const MSSimExperiment & experiment, SimCoordinateType & rt_start, SimCoordinateType & rt_end);
 
     /**
      @brief Samples signals for the given 1D model
@@ -146,18 +221,20 @@ protected:
      @param mz_end End coordinate (in m/z dimension) of the region where the signals will be sampled
      @param rt_start Start coordinate (in rt dimension) of the region where the signals will be sampled
      @param rt_end End coordinate (in rt dimension) of the region where the signals will be sampled
-     @param experiment Experiment to which the sampled signals will be added
-     @param experiment_ct Experiment to which the centroided Ground Truth sampled signals will be added
+     @param experiment Experiment providing the scans
      @param activeFeature The current feature that is simulated
+     @param rnd Random numbers for this feature
+     @param signal The sampled signals (raw and centroided) are added here
      */
     void samplePeptideModel2D_(const ProductModel<2> & pm,
                                const SimCoordinateType mz_start,
                                const SimCoordinateType mz_end,
                                SimCoordinateType rt_start,
                                SimCoordinateType rt_end,
-                               MSSimExperiment & experiment,
-                               MSSimExperiment & experiment_ct,
-                               Feature & activeFeature);
+                               const MSSimExperiment & experiment,
+                               Feature & activeFeature,
+                               CounterRandom_ & rnd,
+                               FeatureSignal_ & signal);
 
     /**
      @brief Add the correct Elution profile to the passed ProductModel
@@ -165,27 +242,46 @@ protected:
     void chooseElutionProfile_(EGHModel * const elutionmodel, Feature & feature, const double scale, const DoubleReal rt_sampling_rate, const MSSimExperiment & experiment);
 
     /**
-     @brief build contaminant feature map
+     @brief build contaminant feature map (the signals are sampled like those of the other features)
+    */
+    void createContaminants_(FeatureMapSim & contaminants, const MSSimExperiment & exp);
+
+    /**
+     @brief Add noise to a scan and store its peaks
+
+     Adds shot noise to the collected @p bins, sums up the intensities of each bin (i.e. compresses the
+     signals which were sampled overlapping) and stores them in @p spectrum. Then white noise and detector
+     noise are added.
+
+     This is used for both LC-MS and MS-only (1D) simulations, so the noise of 1D scans is also drawn from
+     the counter-based random streams.
     */
-    void createContaminants_(FeatureMapSim & contaminants, MSSimExperiment & exp, MSSimExperiment & exp_ct);
+    void finishScan_(Size scan, GridBins_ & bins, MSSimExperiment::SpectrumType & spectrum);
 
-    /// Add shot noise to the experiment
-    void addShotNoise_(MSSimExperiment & experiment, SimCoordinateType minimal_mz_measurement_limit, SimCoordinateType maximal_mz_measurement_limit);
+    /// Add shot noise to a scan
+    void addShotNoise_(Size scan, GridBins_ & bins);
 
-    /// Add white noise to the experiment
-    void addWhiteNoise_(MSSimExperiment & experiment);
+    /// Add white noise to a scan
+    void addWhiteNoise_(Size scan, MSSimExperiment::SpectrumType & spectrum);
 
-    /// Add detector noise to the experiment
-    void addDetectorNoise_(MSSimExperiment & experiment);
+    /// Add detector noise to a scan
+    void addDetectorNoise_(Size scan, MSSimExperiment::SpectrumType & spectrum);
 
-    /// Add a base line to the experiment
-    void addBaseLine_(MSSimExperiment & experiment, SimCoordinateType minimal_mz_measurement_limit);
+    /// Intensity of the base line at m/z position @p mz (0 if no base line is simulated)
+    SimIntensityType getBaseLine_(SimCoordinateType mz) const;
 
     /// get the mz grid where all m/z values will be mapped to
     void getSamplingGrid_(std::vector<SimCoordinateType> & grid, const SimCoordinateType mz_min, const SimCoordinateType mz_max, const Int step_Da);
 
-    /// Compress signales in a single RT scan (to merge signals which were sampled overlapping)
-    void compressSignals_(MSSimExperiment & experiment);
+    /**
+      @brief Index of the grid point closest to @p mz
+
+      Returns grid_.size() - 1 (i.e. the end marker of the grid) for positions which are beyond the grid.
+    */
+    Size getGridBin_(SimCoordinateType mz) const;
+
+    /// Sums up the intensities of each bin (the result is sorted by bin)
+    static void compressBins_(GridBins_ & bins);
 
     /// number of points sampled per peak's FWHM
     Int sampling_points_per_FWHM_;
@@ -200,10 +296,11 @@ protected:
      *
      * @param feature_intensity Intensity of the current feature.
      * @param natural_scaling_factor Additional scaling factor used by some of the sampling models.
+     * @param standard_normal A standard normal distributed random number, used for the intensity variation.
      *
      * @return Rescaled feature intensity.
      */
-    SimIntensityType getFeatureScaledIntensity_(const SimIntensityType feature_intensity, const SimIntensityType natural_scaling_factor);
+    SimIntensityType getFeatureScaledIntensity_(const SimIntensityType feature_intensity, const SimIntensityType natural_scaling_factor, const DoubleReal standard_normal);
 
 
     /**
@@ -252,18 +349,21 @@ protected:
 
     std::vector<ContaminantInfo> contaminants_;
 
-    /**
-    @p threaded_random_numbers keeps a set of random numbers for each thread simulating a feature.
-      */
-    std::vector<std::vector<double> > threaded_random_numbers_;
+    /// distortion of each scan (cached from the 'distortion' meta value of the scans)
+    std::vector<DoubleReal> distortions_;
 
-    /**
-      Indicates which random numbers each thread has used already and if the random number pool
-      should be rebuild.
-      */
-    std::vector<Size> threaded_random_numbers_index_;
+    /// seed of the counter-based random numbers (drawn from the technical random number generator)
+    UInt64 random_seed_;
+
+    /// lower m/z limit of the scans
+    SimCoordinateType minimal_mz_measurement_limit_;
+    /// upper m/z limit of the scans
+    SimCoordinateType maximal_mz_measurement_limit_;
 
-    static const Size THREADED_RANDOM_NUMBER_POOL_SIZE_ = 500;
+    /// Scaling of the base line (0 if disabled, or not MALDI)
+    DoubleReal baseline_scale_;
+    /// Shape of the base line
+    DoubleReal baseline_shape_;
 
     bool contaminants_loaded_;
   };
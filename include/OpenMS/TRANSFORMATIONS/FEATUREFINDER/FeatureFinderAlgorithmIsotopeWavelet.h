@@ -44,6 +44,10 @@
 #include <time.h>
 #include <algorithm>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifdef OPENMS_HAS_TBB
 #include <OpenMS/TRANSFORMATIONS/FEATUREFINDER/IsotopeWaveletParallelFor.h>
 #include <tbb/task_scheduler_init.h>
@@ -68,6 +72,9 @@ namespace OpenMS
   overlapping patterns (see also Hussong et. al (2009)) and slightly shifts masses to the right
    due to the construction of the wavelet.
 
+  If OpenMS has been built with OpenMP support and no GPU is used, the wavelet transforms of the spectra are computed by all
+  available threads (see IsotopeWaveletTransform::getTransforms), without requiring CUDA or TBB.
+
       @htmlinclude OpenMS_FeatureFinderAlgorithmIsotopeWavelet.parameters
 
       @ingroup FeatureFinder
@@ -308,120 +315,167 @@ public:
         }
 #endif
 
-        for (UInt i = 0; i < this->map_->size(); ++i)
+        bool multi_threaded = false;
+#ifdef _OPENMP
+        multi_threaded = !use_cuda_ && omp_get_max_threads() > 1;
+#endif
+        if (multi_threaded)
+        {
+          processSpectraMultiThreaded_(*iwt);
+        }
+        else
         {
-          const MSSpectrum<PeakType> & c_ref((*this->map_)[i]);
+          for (UInt i = 0; i < this->map_->size(); ++i)
+          {
+            const MSSpectrum<PeakType> & c_ref((*this->map_)[i]);
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-          std::cout << ::std::fixed << ::std::setprecision(6) << "Spectrum " << i + 1 << " (" << (*this->map_)[i].getRT() << ") of " << this->map_->size() << " ... ";
-          std::cout.flush();
+            std::cout << ::std::fixed << ::std::setprecision(6) << "Spectrum " << i + 1 << " (" << (*this->map_)[i].getRT() << ") of " << this->map_->size() << " ... ";
+            std::cout.flush();
 #endif
 
-          if (c_ref.size() <= 1)               //unable to do transform anything
-          {
+            if (c_ref.size() <= 1)               //unable to do transform anything
+            {
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-            std::cout << "scan empty or consisting of a single data point. Skipping." << std::endl;
+              std::cout << "scan empty or consisting of a single data point. Skipping." << std::endl;
 #endif
-            this->ff_->setProgress(progress_counter_ += 2);
-            continue;
-          }
+              this->ff_->setProgress(progress_counter_ += 2);
+              continue;
+            }
 
-          if (!use_cuda_)
-          {
-            if (!hr_data_)                 //Lowres data
+            if (!use_cuda_)
             {
-              iwt->initializeScan((*this->map_)[i]);
-              for (UInt c = 0; c < max_charge_; ++c)
+              if (!hr_data_)                 //Lowres data
               {
-                MSSpectrum<PeakType> c_trans(c_ref);
+                iwt->initializeScan((*this->map_)[i]);
+                for (UInt c = 0; c < max_charge_; ++c)
+                {
+                  MSSpectrum<PeakType> c_trans(c_ref);
 
-                iwt->getTransform(c_trans, c_ref, c);
+                  iwt->getTransform(c_trans, c_ref, c);
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::stringstream stream;
-                stream << "cpu_lowres_" << c_ref.getRT() << "_" << c + 1 << ".trans\0";
-                std::ofstream ofile(stream.str().c_str());
-                for (UInt k = 0; k < c_ref.size(); ++k)
-                {
-                  ofile << ::std::setprecision(8) << std::fixed << c_trans[k].getMZ() << "\t" << c_trans[k].getIntensity() << "\t" << c_ref[k].getIntensity() << std::endl;
-                }
-                ofile.close();
+                  std::stringstream stream;
+                  stream << "cpu_lowres_" << c_ref.getRT() << "_" << c + 1 << ".trans\0";
+                  std::ofstream ofile(stream.str().c_str());
+                  for (UInt k = 0; k < c_ref.size(); ++k)
+                  {
+                    ofile << ::std::setprecision(8) << std::fixed << c_trans[k].getMZ() << "\t" << c_trans[k].getIntensity() << "\t" << c_ref[k].getIntensity() << std::endl;
+                  }
+                  ofile.close();
 #endif
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::cout << "transform O.K. ... "; std::cout.flush();
+                  std::cout << "transform O.K. ... "; std::cout.flush();
 #endif
-                this->ff_->setProgress(++progress_counter_);
+                  this->ff_->setProgress(++progress_counter_);
 
-                iwt->identifyCharge(c_trans, c_ref, i, c, intensity_threshold_, check_PPMs_);
+                  iwt->identifyCharge(c_trans, c_ref, i, c, intensity_threshold_, check_PPMs_);
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::cout << "charge recognition O.K. ... "; std::cout.flush();
+                  std::cout << "charge recognition O.K. ... "; std::cout.flush();
 #endif
-                this->ff_->setProgress(++progress_counter_);
+                  this->ff_->setProgress(++progress_counter_);
+                }
               }
-            }
-            else                 //Highres data
-            {
-              MSSpectrum<PeakType> * new_spec(NULL);
-              for (UInt c = 0; c < max_charge_; ++c)
+              else                 //Highres data
               {
-                new_spec = createHRData(i);
-                iwt->initializeScan(*new_spec, c);
-                MSSpectrum<PeakType> c_trans(*new_spec);
+                MSSpectrum<PeakType> * new_spec(NULL);
+                for (UInt c = 0; c < max_charge_; ++c)
+                {
+                  new_spec = createHRData(i);
+                  iwt->initializeScan(*new_spec, c);
+                  MSSpectrum<PeakType> c_trans(*new_spec);
 
-                iwt->getTransformHighRes(c_trans, *new_spec, c);
+                  iwt->getTransformHighRes(c_trans, *new_spec, c);
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::stringstream stream;
-                stream << "cpu_highres_" << new_spec->getRT() << "_" << c + 1 << ".trans\0";
-                std::ofstream ofile(stream.str().c_str());
-                for (UInt k = 0; k < new_spec->size(); ++k)
-                {
-                  ofile << ::std::setprecision(8) << std::fixed << c_trans[k].getMZ() << "\t" << c_trans[k].getIntensity() << "\t" << (*new_spec)[k].getIntensity() << std::endl;
-                }
-                ofile.close();
+                  std::stringstream stream;
+                  stream << "cpu_highres_" << new_spec->getRT() << "_" << c + 1 << ".trans\0";
+                  std::ofstream ofile(stream.str().c_str());
+                  for (UInt k = 0; k < new_spec->size(); ++k)
+                  {
+                    ofile << ::std::setprecision(8) << std::fixed << c_trans[k].getMZ() << "\t" << c_trans[k].getIntensity() << "\t" << (*new_spec)[k].getIntensity() << std::endl;
+                  }
+                  ofile.close();
 #endif
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::cout << "transform O.K. ... "; std::cout.flush();
+                  std::cout << "transform O.K. ... "; std::cout.flush();
 #endif
-                this->ff_->setProgress(++progress_counter_);
+                  this->ff_->setProgress(++progress_counter_);
 
-                iwt->identifyCharge(c_trans, *new_spec, i, c, intensity_threshold_, check_PPMs_);
+                  iwt->identifyCharge(c_trans, *new_spec, i, c, intensity_threshold_, check_PPMs_);
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::cout << "charge recognition O.K. ... "; std::cout.flush();
+                  std::cout << "charge recognition O.K. ... "; std::cout.flush();
 #endif
-                this->ff_->setProgress(++progress_counter_);
+                  this->ff_->setProgress(++progress_counter_);
 
-                delete (new_spec); new_spec = NULL;
+                  delete (new_spec); new_spec = NULL;
+                }
               }
             }
-          }
-          else               //use CUDA but not TBB
-          {
-#ifdef OPENMS_HAS_CUDA
-            bool success = true;
-            typename IsotopeWaveletTransform<PeakType>::TransSpectrum * c_trans(NULL); MSSpectrum<PeakType> * new_spec(NULL);
-            if (!hr_data_)                     //LowRes data
+            else               //use CUDA but not TBB
             {
-              c_trans = new typename IsotopeWaveletTransform<PeakType>::TransSpectrum(&(*this->map_)[i]);
-              success = iwt->initializeScanCuda((*this->map_)[i]) == Constants::CUDA_INIT_SUCCESS;
+#ifdef OPENMS_HAS_CUDA
+              bool success = true;
+              typename IsotopeWaveletTransform<PeakType>::TransSpectrum * c_trans(NULL); MSSpectrum<PeakType> * new_spec(NULL);
+              if (!hr_data_)                     //LowRes data
+              {
+                c_trans = new typename IsotopeWaveletTransform<PeakType>::TransSpectrum(&(*this->map_)[i]);
+                success = iwt->initializeScanCuda((*this->map_)[i]) == Constants::CUDA_INIT_SUCCESS;
+
+                if (success)
+                {
+                  for (UInt c = 0; c < max_charge_; ++c)
+                  {
+                    iwt->getTransformCuda(*c_trans, c);
+
+#ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
+                    std::stringstream stream;
+                    stream << "gpu_lowres_" << ((*this->map_)[i]).getRT() << "_" << c + 1 << ".trans\0";
+                    std::ofstream ofile(stream.str().c_str());
+                    for (UInt k = 0; k < c_trans->size(); ++k)
+                    {
+                      ofile << ::std::setprecision(8) << std::fixed << c_trans->getMZ(k) << "\t" <<  c_trans->getTransIntensity(k) << "\t" << c_trans->getRefIntensity(k) << std::endl;
+                    }
+                    ofile.close();
+#endif
+
+#ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
+                    std::cout << "cuda transform for charge " << c + 1 << "  O.K. ... "; std::cout.flush();
+#endif
+                    this->ff_->setProgress(++progress_counter_);
+
+                    iwt->identifyChargeCuda(*c_trans, i, c, intensity_threshold_, check_PPMs_);
 
-              if (success)
+#ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
+                    std::cout << "cuda charge recognition for charge " << c + 1 << " O.K." << std::endl;
+#endif
+                    this->ff_->setProgress(++progress_counter_);
+                  }
+                  iwt->finalizeScanCuda();
+                }
+                else
+                {
+                  std::cout << "Warning/Error generated at scan " << i << " (" << ((*this->map_)[i]).getRT() << ")." << std::endl;
+                }
+              }
+              else                     //HighRes data
               {
+                c_trans = prepareHRDataCuda(i, iwt);
                 for (UInt c = 0; c < max_charge_; ++c)
                 {
                   iwt->getTransformCuda(*c_trans, c);
 
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
                   std::stringstream stream;
-                  stream << "gpu_lowres_" << ((*this->map_)[i]).getRT() << "_" << c + 1 << ".trans\0";
+                  stream << "gpu_highres_" << ((*this->map_)[i]).getRT() << "_" << c + 1 << ".trans\0";
                   std::ofstream ofile(stream.str().c_str());
                   for (UInt k = 0; k < c_trans->size(); ++k)
                   {
-                    ofile << ::std::setprecision(8) << std::fixed << c_trans->getMZ(k) << "\t" <<  c_trans->getTransIntensity(k) << "\t" << c_trans->getRefIntensity(k) << std::endl;
+                    ofile << ::std::setprecision(8) << std::fixed << c_trans->getMZ(k) << "\t" <<  c_trans->getTransIntensity(k)  << "\t" << c_trans->getRefIntensity(k) << std::endl;
                   }
                   ofile.close();
 #endif
@@ -438,62 +492,26 @@ public:
 #endif
                   this->ff_->setProgress(++progress_counter_);
                 }
+                c_trans->destroy();
                 iwt->finalizeScanCuda();
               }
-              else
-              {
-                std::cout << "Warning/Error generated at scan " << i << " (" << ((*this->map_)[i]).getRT() << ")." << std::endl;
-              }
-            }
-            else                     //HighRes data
-            {
-              c_trans = prepareHRDataCuda(i, iwt);
-              for (UInt c = 0; c < max_charge_; ++c)
-              {
-                iwt->getTransformCuda(*c_trans, c);
-
-#ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::stringstream stream;
-                stream << "gpu_highres_" << ((*this->map_)[i]).getRT() << "_" << c + 1 << ".trans\0";
-                std::ofstream ofile(stream.str().c_str());
-                for (UInt k = 0; k < c_trans->size(); ++k)
-                {
-                  ofile << ::std::setprecision(8) << std::fixed << c_trans->getMZ(k) << "\t" <<  c_trans->getTransIntensity(k)  << "\t" << c_trans->getRefIntensity(k) << std::endl;
-                }
-                ofile.close();
-#endif
-
-#ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::cout << "cuda transform for charge " << c + 1 << "  O.K. ... "; std::cout.flush();
-#endif
-                this->ff_->setProgress(++progress_counter_);
-
-                iwt->identifyChargeCuda(*c_trans, i, c, intensity_threshold_, check_PPMs_);
-
-#ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-                std::cout << "cuda charge recognition for charge " << c + 1 << " O.K." << std::endl;
-#endif
-                this->ff_->setProgress(++progress_counter_);
-              }
-              c_trans->destroy();
-              iwt->finalizeScanCuda();
-            }
 
-            delete (new_spec); new_spec = NULL;
-            delete (c_trans); c_trans = NULL;
+              delete (new_spec); new_spec = NULL;
+              delete (c_trans); c_trans = NULL;
 
 #else
-            std::cerr << "Error: You requested computation on GPU, but OpenMS has not been configured for CUDA usage." << std::endl;
-            std::cerr << "Error: You need to rebuild OpenMS using the configure flag \"--enable-cuda\"." << std::endl;
+              std::cerr << "Error: You requested computation on GPU, but OpenMS has not been configured for CUDA usage." << std::endl;
+              std::cerr << "Error: You need to rebuild OpenMS using the configure flag \"--enable-cuda\"." << std::endl;
 #endif
-          }
+            }
 
-          iwt->updateBoxStates(*this->map_, i, RT_interleave_, real_RT_votes_cutoff_);
+            iwt->updateBoxStates(*this->map_, i, RT_interleave_, real_RT_votes_cutoff_);
 #ifdef OPENMS_DEBUG_ISOTOPE_WAVELET
-          std::cout << "updated box states." << std::endl;
+            std::cout << "updated box states." << std::endl;
 #endif
 
-          std::cout.flush();
+            std::cout.flush();
+          }
         }
 
         this->ff_->endProgress();
@@ -541,6 +559,63 @@ protected:
 
     typedef std::map<UInt, BoxElement> Box;     ///<Key: RT (index), value: BoxElement
 
+    /** @brief Multi-threaded CPU version of the main loop of run().
+
+        The spectra are processed in blocks. The isotope wavelet transforms of all spectra and charge states of a block
+        are computed in parallel (see IsotopeWaveletTransform::getTransforms). The charge recognition and the sweep line
+        depend on the order of the spectra and are applied sequentially afterwards. */
+    void processSpectraMultiThreaded_(IsotopeWaveletTransform<PeakType> & iwt)
+    {
+#ifdef _OPENMP
+      const Size block_size = 4 * omp_get_max_threads();
+#else
+      const Size block_size = 1;
+#endif
+      std::vector<MSSpectrum<PeakType> *> hr_specs(block_size, NULL);
+      std::vector<const MSSpectrum<PeakType> *> c_refs;
+      std::vector<MSSpectrum<PeakType> > c_transes;
+
+      for (Size block_begin = 0; block_begin < this->map_->size(); block_begin += block_size)
+      {
+        const Size block_end = std::min(block_begin + block_size, this->map_->size());
+        c_refs.resize(block_end - block_begin);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (SignedSize i = block_begin; i < (SignedSize)block_end; ++i)
+        {
+          c_refs[i - block_begin] = &(*this->map_)[i];
+          if (hr_data_ && (*this->map_)[i].size() > 1)
+          {
+            hr_specs[i - block_begin] = createHRData(i);
+            c_refs[i - block_begin] = hr_specs[i - block_begin];
+          }
+        }
+
+        iwt.getTransforms(c_transes, c_refs);
+
+        for (Size i = block_begin; i < block_end; ++i)
+        {
+          if ((*this->map_)[i].size() <= 1)               //unable to do transform anything (skipped as in the sequential loop)
+          {
+            this->ff_->setProgress(progress_counter_ += 2);
+            continue;
+          }
+
+          for (UInt c = 0; c < max_charge_; ++c)
+          {
+            this->ff_->setProgress(++progress_counter_);
+            iwt.identifyCharge(c_transes[(i - block_begin) * max_charge_ + c], *c_refs[i - block_begin], i, c, intensity_threshold_, check_PPMs_);
+            this->ff_->setProgress(++progress_counter_);
+          }
+
+          iwt.updateBoxStates(*this->map_, i, RT_interleave_, real_RT_votes_cutoff_);
+
+          delete (hr_specs[i - block_begin]); hr_specs[i - block_begin] = NULL;
+        }
+      }
+    }
+
     UInt max_charge_;     ///<The maximal charge state we will consider
     DoubleReal intensity_threshold_;     ///<The only parameter of the isotope wavelet
     UInt RT_votes_cutoff_, real_RT_votes_cutoff_, RT_interleave_;     ///<The number of subsequent scans a pattern must cover in order to be considered as signal
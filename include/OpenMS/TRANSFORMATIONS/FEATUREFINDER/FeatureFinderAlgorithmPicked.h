@@ -51,6 +51,7 @@
 #include <OpenMS/CHEMISTRY/Element.h>
 #include <OpenMS/CHEMISTRY/ElementDB.h>
 #include <OpenMS/CHEMISTRY/IsotopeDistribution.h>
+#include <OpenMS/SYSTEM/StopWatch.h>
 
 #include <boost/math/special_functions/fpclassify.hpp>
 
@@ -285,35 +286,21 @@ public:
       DoubleReal user_mz_tol = param_.getValue("user-seed:mz_tolerance");
       DoubleReal user_seed_score = param_.getValue("user-seed:min_score");
 
-      //reserve space for calculated scores
+      //reserve space for calculated scores (see scoreIndex_())
       UInt charge_count = charge_high - charge_low + 1;
+      peak_offsets_.resize(map_.size() + 1);
+      peak_offsets_[0] = 0;
       for (Size s = 0; s < map_.size(); ++s)
       {
-        Size scan_size = map_[s].size();
-        map_[s].getFloatDataArrays().resize(3 + 2 * charge_count);
-        map_[s].getFloatDataArrays()[0].setName("trace_score");
-        map_[s].getFloatDataArrays()[0].assign(scan_size, 0.0);
-        map_[s].getFloatDataArrays()[1].setName("intensity_score");
-        map_[s].getFloatDataArrays()[1].assign(scan_size, 0.0);
-        map_[s].getFloatDataArrays()[2].setName("local_max");
-        map_[s].getFloatDataArrays()[2].assign(scan_size, 0.0);
-        //create isotope pattern score arrays
-        UInt charge = charge_low;
-        for (Size i = 3; i < 3 + charge_count; ++i)
-        {
-          map_[s].getFloatDataArrays()[i].setName(String("pattern_score_") + charge);
-          map_[s].getFloatDataArrays()[i].assign(scan_size, 0.0);
-          ++charge;
-        }
-        //create overall score arrays
-        charge = charge_low;
-        for (Size i = 3 + charge_count; i < 3 + 2 * charge_count; ++i)
-        {
-          map_[s].getFloatDataArrays()[i].setName(String("overall_score_") + charge);
-          map_[s].getFloatDataArrays()[i].assign(scan_size, 0.0);
-          ++charge;
-        }
+        peak_offsets_[s + 1] = peak_offsets_[s] + map_[s].size();
       }
+      trace_scores_.assign(peak_offsets_.back(), 0.0);
+      intensity_scores_.assign(peak_offsets_.back(), 0.0);
+      local_max_.assign(peak_offsets_.back(), 0);
+
+      phase_times_.clear();
+      StopWatch phase_watch;
+      phase_watch.start();
 
       int gl_progress = 0;
       debug_ = ((String)(param_.getValue("debug")) == "true");
@@ -323,6 +310,20 @@ public:
         QDir dir(".");
         dir.mkpath("debug/features");
         log_.open("debug/log.txt");
+
+        //attach the scores to the spectra, to store them in debug/input.mzML
+        for (Size s = 0; s < map_.size(); ++s)
+        {
+          FloatDataArrays& arrays = map_[s].getFloatDataArrays();
+          arrays.resize(2 + 2 * charge_count);
+          arrays[0].setName("trace_score");
+          arrays[1].setName("intensity_score");
+          for (UInt i = 0; i < charge_count; ++i)
+          {
+            arrays[2 + i].setName(String("pattern_score_") + (charge_low + i));
+            arrays[2 + charge_count + i].setName(String("overall_score_") + (charge_low + i));
+          }
+        }
       }
 
       //---------------------------------------------------------------------------
@@ -341,12 +342,18 @@ public:
         for (Size rt = 0; rt < intensity_bins_; ++rt)
         {
           intensity_thresholds_[rt].resize(intensity_bins_);
+        }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+        for (SignedSize rt = 0; rt < (SignedSize)intensity_bins_; ++rt)
+        {
           DoubleReal min_rt = rt_start + rt * intensity_rt_step_;
           DoubleReal max_rt = rt_start + (rt + 1) * intensity_rt_step_;
           std::vector<DoubleReal> tmp;
           for (Size mz = 0; mz < intensity_bins_; ++mz)
           {
-            ff_->setProgress(rt * intensity_bins_ + mz);
+            IF_MASTERTHREAD ff_->setProgress(rt * intensity_bins_ + mz);
             DoubleReal min_mz = mz_start + mz * intensity_mz_step_;
             DoubleReal max_mz = mz_start + (mz + 1) * intensity_mz_step_;
             //std::cout << "rt range: " << min_rt << " - " << max_rt << std::endl;
@@ -371,16 +378,20 @@ public:
           }
         }
 
-        //store intensity score in PeakInfo
-        for (Size s = 0; s < map_.size(); ++s)
+        //store intensity scores
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for (SignedSize s = 0; s < (SignedSize)map_.size(); ++s)
         {
           for (Size p = 0; p < map_[s].size(); ++p)
           {
-            map_[s].getFloatDataArrays()[1][p] = intensityScore_(s, p);
+            intensity_scores_[scoreIndex_(s, p)] = intensityScore_(s, p);
           }
         }
         ff_->endProgress();
       }
+      addPhaseTime_("Precalculating intensity scores", phase_watch);
 
       //---------------------------------------------------------------------------
       //Step 2:
@@ -391,9 +402,12 @@ public:
         Size end_iteration = map_.size() - std::min((Size) min_spectra_, map_.size());
         ff_->startProgress(min_spectra_, end_iteration, "Precalculating mass trace scores");
         // skip first and last scans since we cannot extend the mass traces there
-        for (Size s = min_spectra_; s < end_iteration; ++s)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for (SignedSize s = min_spectra_; s < (SignedSize)end_iteration; ++s)
         {
-          ff_->setProgress(s);
+          IF_MASTERTHREAD ff_->setProgress(s);
           const SpectrumType& spectrum = map_[s];
           //iterate over all peaks of the scan
           for (Size p = 0; p < spectrum.size(); ++p)
@@ -438,12 +452,18 @@ public:
             DoubleReal trace_score = std::accumulate(scores.begin(), scores.end(), 0.0) / scores.size();
 
             //store final score for later use
-            map_[s].getFloatDataArrays()[0][p] = trace_score;
-            map_[s].getFloatDataArrays()[2][p] = is_max_peak;
+            trace_scores_[scoreIndex_(s, p)] = trace_score;
+            local_max_[scoreIndex_(s, p)] = is_max_peak;
           }
         }
         ff_->endProgress();
       }
+      if (debug_)
+      {
+        copyScoresToDataArrays_(trace_scores_, 0);
+        copyScoresToDataArrays_(intensity_scores_, 1);
+      }
+      addPhaseTime_("Precalculating mass trace scores", phase_watch);
 
       //---------------------------------------------------------------------------
       //Step 2.5:
@@ -459,7 +479,10 @@ public:
         isotope_distributions_.resize(num_isotopes);
 
         //calculate distribution if necessary
-        for (Size index = 0; index < num_isotopes; ++index)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for (SignedSize index = 0; index < (SignedSize)num_isotopes; ++index)
         {
           //if(debug_) log_ << "Calculating iso dist for mass: " << 0.5*mass_window_width_ + index * mass_window_width_ << std::endl;
           IsotopeDistribution d;
@@ -518,6 +541,7 @@ public:
 
         ff_->endProgress();
       }
+      addPhaseTime_("Precalculating isotope distributions", phase_watch);
 
       //-------------------------------------------------------------------------
       //Step 3:
@@ -527,9 +551,6 @@ public:
       Int feature_nr_global = 0; //counter for the number of features (debug info)
       for (SignedSize c = charge_low; c <= charge_high; ++c)
       {
-        UInt meta_index_isotope = 3 + c - charge_low;
-        UInt meta_index_overall = 3 + charge_count + c - charge_low;
-
         Size feature_candidates = 0;
         std::vector<Seed> seeds;
 
@@ -537,44 +558,61 @@ public:
         //Step 3.1: Precalculate IsotopePattern score
         //-----------------------------------------------------------
         ff_->startProgress(0, map_.size(), String("Calculating isotope pattern scores for charge ") + String(c));
-        for (Size s = 0; s < map_.size(); ++s)
+        pattern_scores_.assign(peak_offsets_.back(), 0.0);
+        // The scores of peaks in the adjacent spectra are updated as well. Thus, the spectra are
+        // processed in blocks and only every other block is processed concurrently.
+        // The debug output is written sequentially.
+        const SignedSize block_size = 8;
+        const SignedSize block_count = (map_.size() + block_size - 1) / block_size;
+        for (SignedSize parity = 0; parity < 2; ++parity)
         {
-          ff_->setProgress(s);
-          const SpectrumType& spectrum = map_[s];
-          for (Size p = 0; p < spectrum.size(); ++p)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1) if (!debug_)
+#endif
+          for (SignedSize block = parity; block < block_count; block += 2)
           {
-            DoubleReal mz = spectrum[p].getMZ();
+            IF_MASTERTHREAD ff_->setProgress(block * block_size);
+            const Size block_end = std::min((Size)((block + 1) * block_size), map_.size());
+            for (Size s = block * block_size; s < block_end; ++s)
+            {
+              const SpectrumType& spectrum = map_[s];
+              for (Size p = 0; p < spectrum.size(); ++p)
+              {
+                DoubleReal mz = spectrum[p].getMZ();
 
-            //get isotope distribution for this mass
-            const TheoreticalIsotopePattern& isotopes = getIsotopeDistribution_(mz * c);
-            //determine highest peak in isotope distribution
-            Size max_isotope = std::max_element(isotopes.intensity.begin(), isotopes.intensity.end()) - isotopes.intensity.begin();
-            //Look up expected isotopic peaks (in the current spectrum or adjacent spectra)
-            Size peak_index = spectrum.findNearest(mz - ((DoubleReal)(isotopes.size() + 1) / c));
-            IsotopePattern pattern(isotopes.size());
+                //get isotope distribution for this mass
+                const TheoreticalIsotopePattern& isotopes = getIsotopeDistribution_(mz * c);
+                //determine highest peak in isotope distribution
+                Size max_isotope = std::max_element(isotopes.intensity.begin(), isotopes.intensity.end()) - isotopes.intensity.begin();
+                //Look up expected isotopic peaks (in the current spectrum or adjacent spectra)
+                Size peak_index = spectrum.findNearest(mz - ((DoubleReal)(isotopes.size() + 1) / c));
+                IsotopePattern pattern(isotopes.size());
 
-            for (Size i = 0; i < isotopes.size(); ++i)
-            {
-              DoubleReal isotope_pos = mz + ((DoubleReal)i - max_isotope) / c;
-              findIsotope_(isotope_pos, s, pattern, i, peak_index);
-            }
+                for (Size i = 0; i < isotopes.size(); ++i)
+                {
+                  DoubleReal isotope_pos = mz + ((DoubleReal)i - max_isotope) / c;
+                  findIsotope_(isotope_pos, s, pattern, i, peak_index);
+                }
 
-            DoubleReal pattern_score = isotopeScore_(isotopes, pattern, true);
+                DoubleReal pattern_score = isotopeScore_(isotopes, pattern, true);
 
-            //update pattern scores of all contained peaks (if necessary)
-            if (pattern_score > 0.0)
-            {
-              for (Size i = 0; i < pattern.peak.size(); ++i)
-              {
-                if (pattern.peak[i] >= 0 && pattern_score > map_[pattern.spectrum[i]].getFloatDataArrays()[meta_index_isotope][pattern.peak[i]])
+                //update pattern scores of all contained peaks (if necessary)
+                if (pattern_score > 0.0)
                 {
-                  map_[pattern.spectrum[i]].getFloatDataArrays()[meta_index_isotope][pattern.peak[i]] = pattern_score;
+                  for (Size i = 0; i < pattern.peak.size(); ++i)
+                  {
+                    if (pattern.peak[i] >= 0 && pattern_score > pattern_scores_[scoreIndex_(pattern.spectrum[i], pattern.peak[i])])
+                    {
+                      pattern_scores_[scoreIndex_(pattern.spectrum[i], pattern.peak[i])] = pattern_score;
+                    }
+                  }
                 }
               }
             }
           }
         }
         ff_->endProgress();
+        addPhaseTime_("Calculating isotope pattern scores", phase_watch);
         //-----------------------------------------------------------
         //Step 3.2:
         //Find seeds for this charge
@@ -583,20 +621,26 @@ public:
         ff_->startProgress(min_spectra_, end_of_iteration, String("Finding seeds for charge ") + String(c));
 
         DoubleReal min_seed_score = param_.getValue("seed:min_score");
+        overall_scores_.assign(peak_offsets_.back(), 0.0);
+        //seeds are collected per spectrum to keep their order independent of the number of threads
+        std::vector<std::vector<Seed> > spectrum_seeds(map_.size());
         //do nothing for the first few and last few spectra as the scans required to search for traces are missing
-        for (Size s = min_spectra_; s < end_of_iteration; ++s)
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16)
+#endif
+        for (SignedSize s = min_spectra_; s < (SignedSize)end_of_iteration; ++s)
         {
-          ff_->setProgress(s);
+          IF_MASTERTHREAD ff_->setProgress(s);
 
           //iterate over peaks
           for (Size p = 0; p < map_[s].size(); ++p)
           {
-            FloatDataArrays& meta = map_[s].getFloatDataArrays();
-            DoubleReal overall_score = std::pow(meta[0][p] * meta[1][p] * meta[meta_index_isotope][p], 1.0f / 3.0f);
-            meta[meta_index_overall][p] = overall_score;
+            const Size index = scoreIndex_(s, p);
+            DoubleReal overall_score = std::pow(trace_scores_[index] * intensity_scores_[index] * pattern_scores_[index], 1.0f / 3.0f);
+            overall_scores_[index] = overall_score;
 
             //add seed to vector if certain conditions are fulfilled
-            if (meta[2][p] != 0.0) // local maximum of mass trace is prerequisite for all features
+            if (local_max_[index] != 0) // local maximum of mass trace is prerequisite for all features
             {
               //automatic seeds: overall score greater than the min seed score
               if (!user_seeds && overall_score >= min_seed_score)
@@ -605,7 +649,7 @@ public:
                 seed.spectrum = s;
                 seed.peak = p;
                 seed.intensity = map_[s][p].getIntensity();
-                seeds.push_back(seed);
+                spectrum_seeds[s].push_back(seed);
               }
               //user-specified seeds: overall score greater than USER min seed score
               else if (user_seeds && overall_score >= user_seed_score)
@@ -626,7 +670,7 @@ public:
                     seed.spectrum = s;
                     seed.peak = p;
                     seed.intensity = map_[s][p].getIntensity();
-                    seeds.push_back(seed);
+                    spectrum_seeds[s].push_back(seed);
                     break;
                   }
                 }
@@ -634,6 +678,10 @@ public:
             }
           }
         }
+        for (Size s = 0; s < spectrum_seeds.size(); ++s)
+        {
+          seeds.insert(seeds.end(), spectrum_seeds[s].begin(), spectrum_seeds[s].end());
+        }
         //sort seeds according to intensity
         std::sort(seeds.rbegin(), seeds.rend());
         //create and store seeds map and selected peak map
@@ -646,21 +694,25 @@ public:
           {
             Size spectrum = seeds[i].spectrum;
             Size peak = seeds[i].peak;
-            const FloatDataArrays& meta = map_[spectrum].getFloatDataArrays();
+            const Size index = scoreIndex_(spectrum, peak);
             Feature tmp;
             tmp.setIntensity(seeds[i].intensity);
-            tmp.setOverallQuality(meta[meta_index_overall][peak]);
+            tmp.setOverallQuality(overall_scores_[index]);
             tmp.setRT(map_[spectrum].getRT());
             tmp.setMZ(map_[spectrum][peak].getMZ());
-            tmp.setMetaValue("intensity_score", meta[1][peak]);
-            tmp.setMetaValue("pattern_score", meta[meta_index_isotope][peak]);
-            tmp.setMetaValue("trace_score", meta[0][peak]);
+            tmp.setMetaValue("intensity_score", intensity_scores_[index]);
+            tmp.setMetaValue("pattern_score", pattern_scores_[index]);
+            tmp.setMetaValue("trace_score", trace_scores_[index]);
             seed_map.push_back(tmp);
           }
           FeatureXMLFile().store(String("debug/seeds_") + String(c) + ".featureXML", seed_map);
+
+          copyScoresToDataArrays_(pattern_scores_, 2 + c - charge_low);
+          copyScoresToDataArrays_(overall_scores_, 2 + charge_count + c - charge_low);
         }
 
         ff_->endProgress();
+        addPhaseTime_("Finding seeds", phase_watch);
         std::cout << "Found " << seeds.size() << " seeds for charge " << c << "." << std::endl;
 
         //------------------------------------------------------------------
@@ -724,7 +776,7 @@ public:
             //extend the convex hull in RT dimension (starting from the trace peaks)
             MassTraces traces;
             traces.reserve(best_pattern.peak.size());
-            extendMassTraces_(best_pattern, traces, meta_index_overall);
+            extendMassTraces_(best_pattern, traces);
 
             //check if the traces are still valid
             DoubleReal seed_mz = map_[seeds[i].spectrum][seeds[i].peak].getMZ();
@@ -955,6 +1007,7 @@ public:
 
         IF_MASTERTHREAD ff_->endProgress();
         std::cout << "Found " << feature_candidates << " feature candidates for charge " << c << "." << std::endl;
+        addPhaseTime_("Extending seeds", phase_watch);
       }
       // END OPENMP
 
@@ -1063,6 +1116,7 @@ public:
       features_->sortByIntensity(true);
       ff_->endProgress();
       std::cout << features_->size() << " features left." << std::endl;
+      addPhaseTime_("Resolving overlapping features", phase_watch);
 
       //Abort reasons
       std::cout << std::endl;
@@ -1071,6 +1125,14 @@ public:
       {
         std::cout << "- " << it->first << ": " << it->second << std::endl;
       }
+
+      //Run time of the processing steps
+      std::cout << std::endl;
+      std::cout << "Run time of the processing steps:" << std::endl;
+      for (Size i = 0; i < phase_times_.size(); ++i)
+      {
+        std::cout << "- " << phase_times_[i].first << ": " << String::number(phase_times_[i].second, 2) << " s" << std::endl;
+      }
       if (debug_)
       {
         //store map of abort reasons for failed seeds
@@ -1090,11 +1152,7 @@ public:
         abort_map.setUniqueId();
         FeatureXMLFile().store("debug/abort_reasons.featureXML", abort_map);
 
-        //store input map with calculated scores (without overall score)
-        for (Size s = 0; s < map_.size(); ++s)
-        {
-          map_[s].getFloatDataArrays().erase(map_[s].getFloatDataArrays().begin() + 2);
-        }
+        //store input map with calculated scores
         MzMLFile().store("debug/input.mzML", map_);
       }
 
@@ -1157,6 +1215,58 @@ protected:
     ///Vector of precalculated isotope distributions for several mass windows
     std::vector<TheoreticalIsotopePattern> isotope_distributions_;
 
+    /// @name Precalculated peak scores (indexed by scoreIndex_())
+    //@{
+    /// Index of the first peak of each spectrum in the score tables (plus the total number of peaks)
+    std::vector<Size> peak_offsets_;
+    /// Mass trace scores
+    std::vector<Real> trace_scores_;
+    /// Intensity scores
+    std::vector<Real> intensity_scores_;
+    /// Flags for peaks that are the maximum of their mass trace
+    std::vector<unsigned char> local_max_;
+    /// Isotope pattern scores for the current charge
+    std::vector<Real> pattern_scores_;
+    /// Overall scores for the current charge
+    std::vector<Real> overall_scores_;
+    //@}
+
+    /// Run times of the processing steps (for the timing report)
+    std::vector<std::pair<String, DoubleReal> > phase_times_;
+
+    /// Returns the index of peak @p peak of spectrum @p spectrum in the score tables
+    Size scoreIndex_(Size spectrum, Size peak) const
+    {
+      return peak_offsets_[spectrum] + peak;
+    }
+
+    /// Copies the score table @p scores to the float data arrays with index @p index of the spectra (debug output)
+    void copyScoresToDataArrays_(const std::vector<Real>& scores, Size index)
+    {
+      for (Size s = 0; s < map_.size(); ++s)
+      {
+        map_[s].getFloatDataArrays()[index].assign(scores.begin() + peak_offsets_[s], scores.begin() + peak_offsets_[s + 1]);
+      }
+    }
+
+    /// Adds the time measured by @p watch to the processing step @p phase and restarts @p watch
+    void addPhaseTime_(const String& phase, StopWatch& watch)
+    {
+      watch.stop();
+      DoubleReal time = watch.getClockTime();
+      watch.reset();
+      watch.start();
+      for (Size i = 0; i < phase_times_.size(); ++i)
+      {
+        if (phase_times_[i].first == phase)
+        {
+          phase_times_[i].second += time;
+          return;
+        }
+      }
+      phase_times_.push_back(std::make_pair(phase, time));
+    }
+
     // Docu in base class
     virtual void updateMembers_()
     {
@@ -1362,9 +1472,8 @@ protected:
 
       @param pattern The IsotopePattern that should be extended.
       @param traces The MassTraces datastructure where the extended mass traces will be stored in.
-      @param meta_index_overall The index of the data array where the qualtiy scores for the given charge are stored.
     */
-    void extendMassTraces_(const IsotopePattern& pattern, MassTraces& traces, Size meta_index_overall) const
+    void extendMassTraces_(const IsotopePattern& pattern, MassTraces& traces) const
     {
       //find index of the trace with the maximum intensity
       DoubleReal max_int =  0.0;
@@ -1389,8 +1498,8 @@ protected:
       //initialize the trace and extend
       MassTrace max_trace;
       max_trace.peaks.push_back(std::make_pair(start_rt, start_peak));
-      extendMassTrace_(max_trace, start_index, start_mz, false, meta_index_overall);
-      extendMassTrace_(max_trace, start_index, start_mz, true, meta_index_overall);
+      extendMassTrace_(max_trace, start_index, start_mz, false);
+      extendMassTrace_(max_trace, start_index, start_mz, true);
 
       DoubleReal rt_max = max_trace.peaks.back().first;
       DoubleReal rt_min = max_trace.peaks.begin()->first;
@@ -1466,8 +1575,8 @@ protected:
         const PeakType* seed = &(map_[starting_peak.spectrum][starting_peak.peak]);
         //initialize trace with seed data and extend
         trace.peaks.push_back(std::make_pair(map_[starting_peak.spectrum].getRT(), seed));
-        extendMassTrace_(trace, starting_peak.spectrum, seed->getMZ(), false, meta_index_overall, rt_min, rt_max);
-        extendMassTrace_(trace, starting_peak.spectrum, seed->getMZ(), true, meta_index_overall, rt_min, rt_max);
+        extendMassTrace_(trace, starting_peak.spectrum, seed->getMZ(), false, rt_min, rt_max);
+        extendMassTrace_(trace, starting_peak.spectrum, seed->getMZ(), true, rt_min, rt_max);
 
         //check if enough peaks were found
         if (!trace.isValid())
@@ -1500,14 +1609,13 @@ protected:
       @param spectrum_index The index of the spectrum from which on the mass trace should be extended
       @param mz The mz location (center) of the trace
       @param increase_rt Indicator whether the extension is done in forward or backward direction (with respect to the current spectrum)
-      @param meta_index_overall The index of the overall score
       @param min_rt The rt minimum up to which the trace will be extended.
       @param max_rt The rt maximum up to which the trace will be extended.
 
       @note This method assumes that it extends from a local maximum.
       @note If @c min_rt or @c max_rt are set to 0.0 no boundary is assumed in the respective direction.
     */
-    void extendMassTrace_(MassTrace& trace, SignedSize spectrum_index, DoubleReal mz, bool increase_rt, Size meta_index_overall, DoubleReal min_rt = 0.0, DoubleReal max_rt = 0.0) const
+    void extendMassTrace_(MassTrace& trace, SignedSize spectrum_index, DoubleReal mz, bool increase_rt, DoubleReal min_rt = 0.0, DoubleReal max_rt = 0.0) const
     {
       //Reverse peaks if we run the method for the second time (to keep them in chronological order)
       if (increase_rt)
@@ -1564,7 +1672,7 @@ protected:
         // check if the peak is "missing"
         if (
           peak_index < 0 // no peak found
-           || map_[spectrum_index].getFloatDataArrays()[meta_index_overall][peak_index] < 0.01 // overall score is to low
+           || overall_scores_[scoreIndex_(spectrum_index, peak_index)] < 0.01 // overall score is to low
            || positionScore_(mz, map_[spectrum_index][peak_index].getMZ(), trace_tolerance_) == 0.0 // deviation of mz is too big
           )
         {
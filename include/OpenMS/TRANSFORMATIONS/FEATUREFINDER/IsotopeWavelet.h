@@ -89,6 +89,16 @@ public:
         * @param tz1 t (the position) times the charge (z) plus 1. */
     static DoubleReal getValueByLambda(const DoubleReal lambda, const DoubleReal tz1);
 
+    /** @brief Computes the values of the isotope wavelet at @p n positions via the fast table lookup.
+        *
+        * Equivalent to calling @see getValueByLambda for each position, but the terms depending only on @p lambda are
+        * computed once and the loop body is free of function calls except for exp, s.t. the compiler can vectorize it.
+        * @param lambda The mass-parameter lambda.
+        * @param tz1 The positions (t times the charge z plus 1).
+        * @param values Returns the values of the wavelet at the positions @p tz1.
+        * @param n The number of positions. */
+    static void getValuesByLambda(const DoubleReal lambda, const DoubleReal * tz1, DoubleReal * values, const Size n);
+
     /** @brief Returns the value of the isotope wavelet at position @p t.
         * This function is usually significantly slower than the table lookup performed in @see getValueByLambda.
         * Nevertheless, it might be necessary to call this function due to extrapolating reasons caused by the
@@ -52,6 +52,10 @@
 #include <fstream>
 #include <iomanip>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #ifdef OPENMS_HAS_CUDA
 #include <cuda.h>
 #include <OpenMS/TRANSFORMATIONS/FEATUREFINDER/IsotopeWaveletCudaKernel.h>
@@ -250,6 +254,15 @@ protected:
         * @param c The charge state minus 1 (e.g. c=2 means charge state 3) at which you want to compute the transform. */
     virtual void getTransformHighRes(MSSpectrum<PeakType>& c_trans, const MSSpectrum<PeakType>& c_ref, const UInt c);
 
+    /** @brief Computes the isotope wavelet transforms of several spectra for all charge states (multi-threaded CPU version).
+        *
+        * Equivalent to calling initializeScan and getTransform (or getTransformHighRes for high resolution data) for every
+        * spectrum and charge state, but the pairs of spectra and charge states are distributed over all available OpenMP threads.
+        * Spectra consisting of less than two data points are skipped (their transforms are left empty).
+        * @param c_transes The transforms. The transform of spectrum i for charge state c+1 is stored at position i*max_charge+c.
+        * @param c_refs The reference spectra. */
+    void getTransforms(std::vector<MSSpectrum<PeakType> >& c_transes, const std::vector<const MSSpectrum<PeakType>*>& c_refs) const;
+
     /** @brief Given an isotope wavelet transformed spectrum @p candidates, this function assigns to every significant
         * pattern its corresponding charge state and a score indicating the reliability of the prediction. The result of this
         * process is stored internally. Important: Before calling this function, apply updateRanges() to the original map.
@@ -387,6 +400,16 @@ protected:
 
     inline void sampleTheCMarrWavelet_(const MSSpectrum<PeakType>& scan, const Int wavelet_length, const Int mz_index, const UInt charge);
 
+    /** @brief Computes the isotope wavelet transform of charge state @p c (used by getTransform, getTransformHighRes and getTransforms).
+        * @param c_trans The transform.
+        * @param c_ref The reference spectrum.
+        * @param c The charge state minus 1 (e.g. c=2 means charge state 3) at which you want to compute the transform.
+        * @param from_max_to_left The number of data points the wavelet reaches to the left of its maximum.
+        * @param min_spacing The minimal spacing between two data points of @p c_ref.
+        * @param high_res Indicates whether the transform for high resolution data has to be computed. */
+    void computeTransform_(MSSpectrum<PeakType>& c_trans, const MSSpectrum<PeakType>& c_ref, const UInt c,
+                           const Int from_max_to_left, const DoubleReal min_spacing, const bool high_res) const;
+
 
     /** @brief Given a candidate for an isotopic pattern, this function computes the corresponding score
         * @param candidate A isotope wavelet transformed spectrum.
@@ -692,78 +715,117 @@ protected:
   template <typename PeakType>
   void IsotopeWaveletTransform<PeakType>::getTransform(MSSpectrum<PeakType>& c_trans, const MSSpectrum<PeakType>& c_ref, const UInt c)
   {
-    Int spec_size((Int)c_ref.size());
-    //in the very unlikely case that size_t will not fit to int anymore this will be a problem of course
-    //for the sake of simplicity (we need here a signed int) we do not cast at every following comparison individually
-    UInt charge = c + 1;
-    DoubleReal value, T_boundary_left, T_boundary_right, old, c_diff, current, old_pos, my_local_MZ, my_local_lambda, origin, c_mz;
+    computeTransform_(c_trans, c_ref, c, from_max_to_left_, min_spacing_, false);
+  }
 
-    for (Int my_local_pos = 0; my_local_pos < spec_size; ++my_local_pos)
-    {
-      value = 0; T_boundary_left = 0, T_boundary_right = IsotopeWavelet::getMzPeakCutOffAtMonoPos(c_ref[my_local_pos].getMZ(), charge) / (DoubleReal)charge;
-      old = 0; old_pos = (my_local_pos - from_max_to_left_ - 1 >= 0) ? c_ref[my_local_pos - from_max_to_left_ - 1].getMZ() : c_ref[0].getMZ() - min_spacing_;
-      my_local_MZ = c_ref[my_local_pos].getMZ(); my_local_lambda = IsotopeWavelet::getLambdaL(my_local_MZ * charge);
-      c_diff = 0;
-      origin = -my_local_MZ + Constants::IW_QUARTER_NEUTRON_MASS / (DoubleReal)charge;
+  template <typename PeakType>
+  void IsotopeWaveletTransform<PeakType>::getTransformHighRes(MSSpectrum<PeakType>& c_trans, const MSSpectrum<PeakType>& c_ref, const UInt c)
+  {
+    computeTransform_(c_trans, c_ref, c, from_max_to_left_, min_spacing_, true);
+  }
 
-      for (Int current_conv_pos =  std::max(0, my_local_pos - from_max_to_left_); c_diff < T_boundary_right; ++current_conv_pos)
+  template <typename PeakType>
+  void IsotopeWaveletTransform<PeakType>::getTransforms(std::vector<MSSpectrum<PeakType> >& c_transes, const std::vector<const MSSpectrum<PeakType>*>& c_refs) const
+  {
+    c_transes.resize(c_refs.size() * max_charge_);
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 1)
+#endif
+    for (SignedSize j = 0; j < (SignedSize)c_transes.size(); ++j)
+    {
+      const MSSpectrum<PeakType>& c_ref(*c_refs[j / max_charge_]);
+      MSSpectrum<PeakType>& c_trans(c_transes[j]);
+      if (c_ref.size() <= 1)
       {
-        if (current_conv_pos >= spec_size)
-        {
-          value += 0.5 * old * min_spacing_;
-          break;
-        }
-
-        c_mz = c_ref[current_conv_pos].getMZ();
-        c_diff = c_mz + origin;
-
-        //Attention! The +1. has nothing to do with the charge, it is caused by the wavelet's formula (tz1).
-        current = c_diff > T_boundary_left && c_diff <= T_boundary_right ? IsotopeWavelet::getValueByLambda(my_local_lambda, c_diff * charge + 1.) * c_ref[current_conv_pos].getIntensity() : 0;
-
-        value += 0.5 * (current + old) * (c_mz - old_pos);
-
-        old = current;
-        old_pos = c_mz;
+        c_trans.clear(true);
+        continue;
       }
 
+      //the scan dependent parameters (see initializeScan and computeMinSpacing)
+      DoubleReal min_spacing = INT_MAX;
+      for (UInt c_conv_pos = 1; c_conv_pos < c_ref.size(); ++c_conv_pos)
+      {
+        min_spacing = std::min(min_spacing, c_ref[c_conv_pos].getMZ() - c_ref[c_conv_pos - 1].getMZ());
+      }
+      Int from_max_to_left = (UInt) (Constants::IW_QUARTER_NEUTRON_MASS / min_spacing);
 
-
-      c_trans[my_local_pos].setIntensity(value);
+      c_trans = c_ref;
+      computeTransform_(c_trans, c_ref, j % max_charge_, from_max_to_left, min_spacing, hr_data_);
     }
   }
 
   template <typename PeakType>
-  void IsotopeWaveletTransform<PeakType>::getTransformHighRes(MSSpectrum<PeakType>& c_trans, const MSSpectrum<PeakType>& c_ref, const UInt c)
+  void IsotopeWaveletTransform<PeakType>::computeTransform_(MSSpectrum<PeakType>& c_trans, const MSSpectrum<PeakType>& c_ref, const UInt c,
+                                                            const Int from_max_to_left, const DoubleReal min_spacing, const bool high_res) const
   {
     Int spec_size((Int)c_ref.size());
     //in the very unlikely case that size_t will not fit to int anymore this will be a problem of course
     //for the sake of simplicity (we need here a signed int) we do not cast at every following comparison individually
     UInt charge = c + 1;
-    DoubleReal value, T_boundary_left, T_boundary_right, c_diff, current, my_local_MZ, my_local_lambda, origin, c_mz;
+    DoubleReal value, T_boundary_left, T_boundary_right, old, c_diff, current, old_pos, my_local_MZ, my_local_lambda, origin, c_mz;
+
+    //positions (tz1) and values of the wavelet within its support, computed in one batch per data point
+    std::vector<DoubleReal> tz1s, psis;
 
     for (Int my_local_pos = 0; my_local_pos < spec_size; ++my_local_pos)
     {
       value = 0; T_boundary_left = 0, T_boundary_right = IsotopeWavelet::getMzPeakCutOffAtMonoPos(c_ref[my_local_pos].getMZ(), charge) / (DoubleReal)charge;
-
-
       my_local_MZ = c_ref[my_local_pos].getMZ(); my_local_lambda = IsotopeWavelet::getLambdaL(my_local_MZ * charge);
-      c_diff = 0;
       origin = -my_local_MZ + Constants::IW_QUARTER_NEUTRON_MASS / (DoubleReal)charge;
 
-      for (Int current_conv_pos =  std::max(0, my_local_pos - from_max_to_left_); c_diff < T_boundary_right; ++current_conv_pos)
+      //determine the data points covered by the wavelet: all points up to (and including) the first one beyond its right boundary
+      //the wavelet is non-zero only at the points within (T_boundary_left, T_boundary_right], which form a contiguous range
+      Int first_conv_pos = std::max(0, my_local_pos - from_max_to_left), end_conv_pos = first_conv_pos, support_begin = first_conv_pos;
+      c_diff = 0;
+      tz1s.clear();
+      while (c_diff < T_boundary_right && end_conv_pos < spec_size)
       {
-        if (current_conv_pos >= spec_size)
+        c_diff = c_ref[end_conv_pos].getMZ() + origin;
+        if (c_diff > T_boundary_left && c_diff <= T_boundary_right)
         {
-          break;
+          if (tz1s.empty())
+          {
+            support_begin = end_conv_pos;
+          }
+          //Attention! The +1. has nothing to do with the charge, it is caused by the wavelet's formula (tz1).
+          tz1s.push_back(c_diff * charge + 1.);
         }
+        ++end_conv_pos;
+      }
+      //reached the end of the spectrum before the right boundary of the wavelet
+      bool truncated = c_diff < T_boundary_right;
 
-        c_mz = c_ref[current_conv_pos].getMZ();
-        c_diff = c_mz + origin;
+      psis.resize(tz1s.size());
+      if (!tz1s.empty())
+      {
+        IsotopeWavelet::getValuesByLambda(my_local_lambda, &tz1s[0], &psis[0], tz1s.size());
+      }
 
-        //Attention! The +1. has nothing to do with the charge, it is caused by the wavelet's formula (tz1).
-        current = c_diff > T_boundary_left && c_diff <= T_boundary_right ? IsotopeWavelet::getValueByLambda(my_local_lambda, c_diff * charge + 1.) * c_ref[current_conv_pos].getIntensity() : 0;
+      if (high_res)
+      {
+        for (Size i = 0; i < psis.size(); ++i)
+        {
+          value += psis[i] * c_ref[support_begin + i].getIntensity();
+        }
+      }
+      else
+      {
+        old = 0; old_pos = (first_conv_pos > 0) ? c_ref[first_conv_pos - 1].getMZ() : c_ref[0].getMZ() - min_spacing;
+        for (Int current_conv_pos = first_conv_pos; current_conv_pos < end_conv_pos; ++current_conv_pos)
+        {
+          c_mz = c_ref[current_conv_pos].getMZ();
+          Int i = current_conv_pos - support_begin;
+          current = (i >= 0 && i < (Int)psis.size()) ? psis[i] * c_ref[current_conv_pos].getIntensity() : 0;
+
+          value += 0.5 * (current + old) * (c_mz - old_pos);
 
-        value += current;
+          old = current;
+          old_pos = c_mz;
+        }
+        if (truncated)
+        {
+          value += 0.5 * old * min_spacing;
+        }
       }
 
       c_trans[my_local_pos].setIntensity(value);
@@ -42,6 +42,8 @@
 
 #include <QtGui/QGraphicsScene>
 #include <QtCore/QProcess>
+#include <QtCore/QHash>
+#include <QtCore/QTime>
 
 namespace OpenMS
 {
@@ -79,6 +81,17 @@ public:
   Temporary files of the pipeline are stored in the member tmp_path_. Update it when loading a pipeline which has
   tmp data from an old run. TOPPASToolVertex will ask its parent scene() whenever it wants to know the tmp directory.
 
+  The TOPP processes of a running pipeline are scheduled on a global budget of threads and (estimated) memory,
+  see setAllowedThreads() and setAllowedMemory(). Each process is charged with the number of threads of its
+  tool. Among the pending processes which fit into the remaining budget, the one with the longest path of tool
+  vertices to the end of the pipeline (the critical path) is started first. Every start and end of a process
+  is written to the logfile together with the current utilization of the budget.
+
+  If a cache directory is set (see setCacheDir()), the results of every round of a tool are stored there, keyed by
+  a hash of the tool, its parameters and the contents of its input files. When a pipeline is run again, rounds with
+  unchanged tool, parameters and inputs take their output files from the cache instead of calling the tool, so only
+  the part of the pipeline downstream of a change is actually executed.
+
       @ingroup TOPPAS_elements
   */
   class OPENMS_GUI_DLLAPI TOPPASScene :
@@ -92,11 +105,13 @@ public:
     struct TOPPProcess
     {
       /// Constructor
-      TOPPProcess(QProcess * p, const QString & cmd, const QStringList & arg, TOPPASToolVertex * const tool) :
+      TOPPProcess(QProcess * p, const QString & cmd, const QStringList & arg, TOPPASToolVertex * const tool, int num_threads = 1, int mem = 0) :
         proc(p),
         command(cmd),
         args(arg),
-        tv(tool)
+        tv(tool),
+        threads(num_threads),
+        memory(mem)
       {
       }
 
@@ -108,6 +123,10 @@ public:
       QStringList args;
       /// The tool which is started (used to call its slots)
       TOPPASToolVertex * tv;
+      /// The number of threads used by the tool
+      int threads;
+      /// The estimated memory usage of the tool (in MB)
+      int memory;
     };
 
     /// The current action mode (creation of a new edge, or panning of the widget)
@@ -205,7 +224,7 @@ public:
     bool askForOutputDir(bool always_ask = true);
     /// Enqueues the process, it will be run when the currently pending processes have finished
     void enqueueProcess(const TOPPProcess & process);
-    /// Runs the next process in the queue, if any
+    /// Runs the pending processes which fit into the thread and memory budget (critical path first)
     void runNextProcess();
     /// Resets the processes queue
     void resetProcessesQueue();
@@ -235,8 +254,16 @@ public:
     QString getDescription() const;
     /// when description is updated by user, use this to update the description for later storage in file
     void setDescription(const QString & desc);
-    /// sets the maximum number of jobs
+    /// sets the maximum number of threads used by all running processes
     void setAllowedThreads(int num_threads);
+    /// sets the maximum estimated memory (in MB) used by all running processes (0 = unlimited)
+    void setAllowedMemory(int memory);
+    /// sets the directory of the result cache ("" disables the cache)
+    void setCacheDir(const QString & dir);
+    /// returns the directory of the result cache ("" if disabled)
+    const QString & getCacheDir() const;
+    /// counts and logs a lookup of a round of @p tool in the result cache
+    void logCacheLookup(const String & tool, bool hit);
     /// returns the hovering edge
     TOPPASEdge* getHoveringEdge();
     /// Checks whether all output vertices are finished, and if yes, emits entirePipelineFinished() (called by finished output vertices)
@@ -268,8 +295,8 @@ public slots:
     void setPipelineRunning(bool b = true);
     /// Invoked by TTV or other vectices if a parameter was edited
     void changedParameter(const bool invalidates_running_pipeline);
-    /// Called by a finished QProcess to indicate that we are free to start a new one
-    void processFinished();
+    /// Called when the QProcess @p process has finished, releases its resources and starts pending processes
+    void processFinished(QProcess * process);
     /// dirty solution: when using ExecutePipeline this slot is called when the pipeline crashes. This will quit the app
     void quitWithError();
 
@@ -348,12 +375,34 @@ protected:
     TOPPASScene * clipboard_;
     /// dry run mode (no tools are actually called)
     bool dry_run_;
-    /// currently running processes...
+    /// number of threads used by the currently running processes
     int threads_active_;
     /// description text
     QString description_text_;
     /// maximum number of allowed threads
     int allowed_threads_;
+    /// estimated memory (in MB) used by the currently running processes
+    int memory_active_;
+    /// maximum estimated memory (in MB) of the running processes (0 = unlimited)
+    int allowed_memory_;
+    /// the currently running processes (to release their resources once they are finished)
+    QList<TOPPProcess> running_processes_;
+    /// number of tool vertices on the longest path from a vertex to the end of the pipeline (updated by topoSort())
+    QHash<const TOPPASVertex *, int> critical_path_;
+    /// wall clock of the scheduler, started with the first process of a run
+    QTime schedule_time_;
+    /// time (ms since start of schedule_time_) of the last change of the running processes
+    int last_schedule_change_;
+    /// sum of threads_active_ over time (in thread seconds)
+    double thread_seconds_;
+    /// maximum of memory_active_ during the run
+    int memory_peak_;
+    /// directory of the result cache ("" if disabled)
+    QString cache_dir_;
+    /// number of rounds whose results were taken from the cache
+    int cache_hits_;
+    /// number of rounds which were not found in the cache
+    int cache_misses_;
     /// last node where 'resume' was started
     TOPPASToolVertex* resume_source_;
 
@@ -374,6 +423,11 @@ protected:
 
     ///Writes the @p text to the logfile
     void writeToLogFile_(const QString & text);
+
+    /// Adds the utilization since the last change of the running processes to thread_seconds_
+    void updateUtilization_();
+    /// Writes the scheduler @p event together with the current utilization to the logfile
+    void logSchedulerEvent_(const String & event);
   };
 
 }
@@ -39,6 +39,9 @@
 #include <OpenMS/DATASTRUCTURES/Param.h>
 
 #include <QtCore/QVector>
+#include <QtCore/QMap>
+#include <QtCore/QPair>
+#include <QtCore/QStringList>
 
 namespace OpenMS
 {
@@ -238,6 +241,20 @@ protected:
     /// Helper method for finding good boundaries for wrapping the tool name. Returns a string with whitespaces at the preferred boundaries.
     QString toolnameWithWhitespacesForFancyWordWrapping_(QPainter * painter, const QString & str);
 
+    /**
+      @brief Computes the key of one round in the result cache of the scene
+
+      The key is a SHA1 hash of the tool name, type and version, the parameters (except for
+      file parameters and 'threads'), the contents of the input files and the names of the
+      output parameters. @p inputs contains the input parameter names (prefixed by '-')
+      each followed by its files, @p output_params the names of the output parameters.
+    */
+    QString computeCacheKey_(const QStringList & inputs, const QStringList & output_params) const;
+    /// Copies the cached files from @p cache_dir to @p outputs, returns false if the cache does not contain them
+    bool restoreFromCache_(const QString & cache_dir, const QStringList & outputs) const;
+    /// Copies @p outputs to @p cache_dir (atomically, via a temporary directory), returns false on failure
+    bool storeInCache_(const QString & cache_dir, const QStringList & outputs) const;
+
     /// The name of the tool
     String name_;
     /// The type of the tool, or "" if it does not have a type
@@ -257,6 +274,9 @@ protected:
     /// Breakpoint set?
     bool breakpoint_set_;
 
+    /// cache directory and output files of the running processes whose results will be added to the cache
+    QMap<QProcess *, QPair<QString, QStringList> > cache_entries_;
+
     /// smart naming of round-based filenames
     /// when basename is not unique we take the preceding directory name
     void smartFileNames_(std::vector< QStringList >& filenames);
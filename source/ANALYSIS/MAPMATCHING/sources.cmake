@@ -5,6 +5,7 @@ set(directory source/ANALYSIS/MAPMATCHING)
 set(sources_list
 BaseGroupFinder.C
 BaseSuperimposer.C
+ConsensusMapIntensityColumns.C
 ConsensusMapNormalizerAlgorithmThreshold.C
 ConsensusMapNormalizerAlgorithmMedian.C
 ConsensusMapNormalizerAlgorithmQuantile.C
@@ -6,6 +6,7 @@ set(sources_list
 BinnedSharedPeakCount.C
 BinnedSpectralContrastAngle.C
 BinnedSpectrum.C
+BinnedSpectrumBlock.C
 BinnedSpectrumCompareFunctor.C
 BinnedSumAgreeingIntensities.C
 CompareFouriertransform.C
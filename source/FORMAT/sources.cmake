@@ -14,6 +14,7 @@ CsvFile.C
 DTA2DFile.C
 DTAFile.C
 EDTAFile.C
+FASTAArena.C
 FASTAFile.C
 FastaIterator.C
 FastaIteratorIntern.C
@@ -54,6 +55,7 @@ ProtXMLFile.C
 SequestInfile.C
 SequestOutfile.C
 SpecArrayFile.C
+SpectralLibraryIndex.C
 SVOutStream.C
 TextFile.C
 ToolDescriptionFile.C
@@ -18,6 +18,7 @@ set(concept_executables_list
 
 set(datastructures_executables_list
 	Adduct_test
+	AlignedAllocator_test
 	CVMappingRule_test
 	CVMappingTerm_test
 	CVMappings_test
@@ -35,6 +36,7 @@ set(datastructures_executables_list
 	DefaultParamHandler_test
 	DistanceMatrix_test
 	DoubleList_test
+	FlatSet_test
 	GridFeature_test
 	HashGrid_test
 	IntList_test
@@ -48,6 +50,7 @@ set(datastructures_executables_list
 	SparseVector_test
 	StringList_test
 	String_test
+	StringView_test
 	SuffixArrayPeptideFinder_test
 	SuffixArraySeqan_test
 	SuffixArrayTrypticCompressed_test
@@ -101,6 +104,7 @@ set(system_executables_list
 )
 
 set(kernel_executables_list
+	AreaIndex_test
 	AreaIterator_test
 	BaseFeature_test
 	ChromatogramPeak_test
@@ -126,6 +130,8 @@ set(kernel_executables_list
 	RangeUtils_test
 	RichPeak1D_test
 	RichPeak2D_test
+	SoAExperiment_test
+	SoASpectrum_test
 	StandardTypes_test
 )
 
@@ -147,6 +153,7 @@ set(format_executables_list
   DTA2DFile_test
   DTAFile_test
   EDTAFile_test
+  FASTAArena_test
   FASTAFile_test
   FeatureXMLFile_test
   FileHandler_test
@@ -194,6 +201,7 @@ set(format_executables_list
   SequestInfile_test
   SequestOutfile_test
   SpecArrayFile_test
+  SpectralLibraryIndex_test
   TextFile_test
   ToolDescriptionFile_test
   TraMLFile_test
@@ -281,6 +289,7 @@ set(comparison_executables_list
   BinnedSharedPeakCount_test
   BinnedSpectralContrastAngle_test
   BinnedSpectrumCompareFunctor_test
+  BinnedSpectrumBlock_test
   BinnedSpectrum_test
   BinnedSumAgreeingIntensities_test
   ClusterAnalyzer_test
@@ -354,6 +363,7 @@ set(analysis_executables_list
 	CompNovoIonScoring_test
   ConfidenceScoring_test
 	ConsensusID_test
+	ConsensusMapIntensityColumns_test
 	ConsensusMapNormalizerAlgorithmThreshold_test
 	#ConsensusMapNormalizerAlgorithmMedian_test
 	#ConsensusMapNormalizerAlgorithmQuantile_test